@@ -0,0 +1,104 @@
+#ifndef _ALIAS_TABLE_H_
+#define _ALIAS_TABLE_H_
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+
+
+/*
+ * walker's alias method for a set of discrete distributions over the same
+ * (at most 256) outcomes, e.g. the rows of a transition matrix. setting a
+ * row is O(n) (vose's version); a draw is then one uniform, a multiply and a
+ * compare, whatever the number of outcomes. rows are stored flat as
+ * [row][outcome]
+ */
+class AliasTable {
+private:
+    int num_rows_;
+    int num_outcomes_;
+    std::vector<double> prob_; // chance of keeping the column drawn
+    std::vector<uint8_t> alias_; // what to take otherwise
+    std::vector<double> scaled_; // scratch for set_row
+    std::vector<int> small_;
+    std::vector<int> large_;
+
+public:
+    AliasTable ():num_rows_(0), num_outcomes_(0) {}
+
+    AliasTable (const int& nrows, const int& noutcomes) {
+        resize(nrows, noutcomes);
+    }
+
+    void resize (const int& nrows, const int& noutcomes) {
+        num_rows_ = nrows;
+        num_outcomes_ = noutcomes;
+        prob_.assign((size_t)nrows * noutcomes, 1.0);
+        alias_.resize((size_t)nrows * noutcomes);
+        for (size_t i = 0; i < alias_.size(); i++) {
+            alias_[i] = (uint8_t)(i % noutcomes);
+        }
+        scaled_.resize(noutcomes);
+        small_.reserve(noutcomes);
+        large_.reserve(noutcomes);
+    }
+
+    // weights need not sum to 1 (they are normalised here) but must not all be 0
+    void set_row (const int& row, const double * weights) {
+        int n = num_outcomes_;
+        double * prob = &prob_[(size_t)row * n];
+        uint8_t * alias = &alias_[(size_t)row * n];
+        double tot = 0.0;
+        for (int i = 0; i < n; i++) {
+            tot += (weights[i] > 0.0) ? weights[i] : 0.0;
+        }
+        small_.clear();
+        large_.clear();
+        for (int i = 0; i < n; i++) {
+            scaled_[i] = ((weights[i] > 0.0) ? weights[i] : 0.0) * n / tot;
+            if (scaled_[i] < 1.0) {
+                small_.push_back(i);
+            } else {
+                large_.push_back(i);
+            }
+        }
+        while (!small_.empty() && !large_.empty()) {
+            int s = small_.back();
+            small_.pop_back();
+            int l = large_.back();
+            prob[s] = scaled_[s];
+            alias[s] = (uint8_t)l;
+            scaled_[l] -= 1.0 - scaled_[s];
+            if (scaled_[l] < 1.0) {
+                large_.pop_back();
+                small_.push_back(l);
+            }
+        }
+        // whatever is left is 1 up to rounding
+        for (size_t i = 0; i < large_.size(); i++) {
+            prob[large_[i]] = 1.0;
+            alias[large_[i]] = (uint8_t)large_[i];
+        }
+        for (size_t i = 0; i < small_.size(); i++) {
+            prob[small_[i]] = 1.0;
+            alias[small_[i]] = (uint8_t)small_[i];
+        }
+    }
+
+    // u uniform on [0, 1)
+    int draw (const int& row, const double& u) const {
+        double x = u * num_outcomes_;
+        int col = (int)x;
+        if (col >= num_outcomes_) {
+            col = num_outcomes_ - 1;
+        }
+        size_t i = (size_t)row * num_outcomes_ + col;
+        return (x - col < prob_[i]) ? col : alias_[i];
+    }
+
+    int get_num_rows () const {
+        return num_rows_;
+    }
+};
+
+#endif /* _ALIAS_TABLE_H_ */
@@ -17,9 +17,8 @@
 BirthDeathSimulator::BirthDeathSimulator (const double& estop, const double& tstop,
     const double& brate, const double& drate, const int& seed):failures_(0), maxfailures_(1000), birthrate_(brate),
     deathrate_(drate), sumrate_(brate+drate), relative_birth_rate_(brate/(brate+drate)),
-    extantstop_(estop), timestop_(tstop), numofchanges_(0), currenttime_(0.0),
-    extantnodes_(std::vector<Node*>()), BIRTHTIME_(std::map<Node*, double>()),
-    DEATHTIME_(std::map<Node*, double>()) {
+    extantstop_(estop), timestop_(tstop), numofchanges_(0), currenttime_(0.0), seed_(seed),
+    extantnodes_(std::vector<Node*>()), pool_used_(0), root_(NULL) {
     if (seed == -1) {
         generator_ =  std::mt19937(get_clock_seed());
     } else {
@@ -33,27 +32,77 @@ BirthDeathSimulator::BirthDeathSimulator (const double& estop, const double& tst
 BirthDeathSimulator::BirthDeathSimulator ():failures_(0), maxfailures_(1000),
     birthrate_(0.1), deathrate_(0.05), sumrate_(0.1+0.05),
     relative_birth_rate_(0.1/(0.1+0.05)), extantstop_(10), timestop_(0), numofchanges_(0),
-    currenttime_(0.0), extantnodes_(std::vector<Node*>()), BIRTHTIME_(std::map<Node*, double>()),
-    DEATHTIME_(std::map<Node*, double>()) {
+    currenttime_(0.0), seed_(-1), extantnodes_(std::vector<Node*>()), pool_used_(0),
+    root_(NULL) {
         generator_ =  std::mt19937(get_clock_seed());
         uniformDistrib_ =  std::uniform_real_distribution<double>(0.0, 1.0);
 }
 
 
+BirthDeathSimulator::~BirthDeathSimulator () {
+    for (unsigned int i=0; i < pool_.size(); i++) {
+        delete pool_[i];
+    }
+}
+
+
+/*
+ * give replicate i its own random number stream (from the seed and i), so a
+ * set of replicates comes out the same however it is split up. replicate 0
+ * uses the seed as is
+ */
+void BirthDeathSimulator::set_replicate (const int& replicate) {
+    if (seed_ == -1) {
+        return;
+    }
+    if (replicate == 0) {
+        generator_ = std::mt19937(seed_);
+    } else {
+        std::seed_seq sseq{seed_, replicate};
+        generator_ = std::mt19937(sseq);
+    }
+}
+
+
+// starts a new tree: every node in the pool is free again
 void BirthDeathSimulator::setup_parameters () {
     numofchanges_ = 0;
     currenttime_ = 0.0;
-    extantnodes_ = std::vector<Node*>();
-    dead_nodes_ = std::vector<Node*>();
-    BIRTHTIME_ = std::map<Node*, double>();
-    DEATHTIME_ = std::map<Node*, double>();
+    extantnodes_.clear();
+    dead_nodes_.clear();
+    pool_used_ = 0;
+}
+
+
+// the next free node of the pool, cleared
+Node * BirthDeathSimulator::new_node () {
+    if (pool_used_ == (int)pool_.size()) {
+        pool_.push_back(new Node());
+        birth_time_.push_back(0.0);
+        death_time_.push_back(0.0);
+    }
+    Node * nd = pool_[pool_used_];
+    while (nd->getChildCount() > 0) {
+        nd->removeChild(*nd->getChild(0));
+    }
+    nd->setName("");
+    nd->setBL(0.0);
+    nd->setHeight(0.0);
+    nd->setNumber(pool_used_);
+    pool_used_++;
+    return nd;
 }
 
 
-Tree * BirthDeathSimulator::make_tree (const bool& show_dead) {
+/*
+ * runs the process until a stop condition is met, restarting if everything
+ * goes extinct. the first node of the pool is always the starting lineage,
+ * so it is the only one that never has a parent
+ */
+void BirthDeathSimulator::simulate () {
     setup_parameters();
-    root_ = new Node();
-    BIRTHTIME_[root_] = currenttime_;
+    root_ = new_node();
+    birth_time_[root_->getNumber()] = currenttime_;
     extantnodes_.push_back(root_);
     
     // actually want to start with 2 lineages
@@ -77,42 +126,74 @@ Tree * BirthDeathSimulator::make_tree (const bool& show_dead) {
                     exit(0);
                 }
                 setup_parameters();
-                root_ = new Node();//need to clean
-                BIRTHTIME_[root_] = currenttime_;//need to clean
-                extantnodes_.push_back(root_);//empty
+                root_ = new_node();
+                birth_time_[root_->getNumber()] = currenttime_;
+                extantnodes_.push_back(root_);
             }
         }
     }
     
     std::vector<Node*> temp_extant_nodes(extantnodes_);
     for (unsigned int i=0; i < temp_extant_nodes.size(); i++) {
-        try {
-            DEATHTIME_[temp_extant_nodes[i]];
-            node_death(temp_extant_nodes[i]);
-        } catch( char * str ) {
-            std::cout << "catch" << std::endl;
-            node_death(temp_extant_nodes[i]);
-            //temp_extant_nodes[i]->istip = 1
-        }
+        node_death(temp_extant_nodes[i]);
     }
-
     root_->setBL(0);
-    double totallength = 0;
-    int count = 1;
-    tree_ = new Tree(root_);
-    tree_->processRoot();
+}
+
+
+// tips in postorder, with their distances from the root
+void BirthDeathSimulator::get_tips (Node * innode, double height, std::vector<Node*>& tips,
+    std::vector<double>& heights) {
+    if (innode->getChildCount() == 0) {
+        tips.push_back(innode);
+        heights.push_back(height);
+        return;
+    }
+    for (int i=0; i < innode->getChildCount(); i++) {
+        Node * child = innode->getChild(i);
+        get_tips(child, height + child->getBL(), tips, heights);
+    }
+}
+
+
+/*
+ * simulates a tree and returns it as newick, tips named taxon_1... in
+ * postorder (numbered before any extinct lineages are pruned). a tree with
+ * fewer than two extant tips gets an extra pair of brackets. the nodes go
+ * back to the pool for the next call
+ */
+std::string BirthDeathSimulator::make_newick (const bool& show_dead) {
+    simulate();
+    std::vector<Node*> tips;
+    std::vector<double> heights;
+    get_tips(root_, 0.0, tips, heights);
+    for (unsigned int i=0; i < tips.size(); i++) {
+        tips[i]->setName("taxon_" + std::to_string(i + 1));
+    }
     if (show_dead == false) {
         delete_dead_nodes();
+        tips.clear();
+        heights.clear();
+        get_tips(root_, 0.0, tips, heights);
     }
-
-    for (int i=0; i < tree_->getExternalNodeCount(); i++) {
-        totallength += tree_->getExternalNode(i)->getBL();
-        std::stringstream out;
-        out << count;
-        tree_->getExternalNode(i)->setName("taxon_"+out.str());
-        count += 1;
+    
+    double largest = 0.0;
+    for (unsigned int i=0; i < heights.size(); i++) {
+        if (heights[i] > largest) {
+            largest = heights[i];
+        }
+    }
+    int extant = 0;
+    for (unsigned int i=0; i < heights.size(); i++) {
+        if (fabs(heights[i] - largest) < 0.00001) {
+            extant += 1;
+        }
+    }
+    if (extant > 1) {
+        return root_->getNewick(true) + ";";
+    } else {
+        return "(" + root_->getNewick(true) + ");";
     }
-    return tree_;
 }
 
 
@@ -160,20 +241,21 @@ void BirthDeathSimulator::event () {
 
 
 void BirthDeathSimulator::node_death (Node *innode) {
-    DEATHTIME_[innode] = currenttime_;
-    double bl = DEATHTIME_[innode] - BIRTHTIME_[innode];
+    int n = innode->getNumber();
+    death_time_[n] = currenttime_;
+    double bl = death_time_[n] - birth_time_[n];
     innode->setBL(bl);
     extantnodes_.erase(find(extantnodes_.begin(), extantnodes_.end(), innode));
 }
 
 
 void BirthDeathSimulator::node_birth (Node *innode) {
-    Node * left = new Node();
-    Node * right = new Node();
+    Node * left = new_node();
+    Node * right = new_node();
     innode->addChild(*left);
     innode->addChild(*right);
-    BIRTHTIME_[left] = currenttime_;
-    BIRTHTIME_[right] = currenttime_;
+    birth_time_[left->getNumber()] = currenttime_;
+    birth_time_[right->getNumber()] = currenttime_;
     node_death(innode);
     extantnodes_.push_back(left);
     extantnodes_.push_back(right);
@@ -187,26 +269,6 @@ void BirthDeathSimulator::delete_dead_nodes () {
 }
 
 
-void BirthDeathSimulator::set_distance_to_tip () {
-    for (int i=0; i < tree_->getExternalNodeCount(); i++) {
-        double curh = 0.0;
-        tree_->getExternalNode(i)->setHeight(curh);
-        Node * tnode = tree_->getExternalNode(i);
-        while (tnode->hasParent()) {
-            curh += tnode->getBL();
-            if (tnode->getHeight() < curh) {
-                tnode->setHeight(curh);
-            }
-            tnode = tnode->getParent();
-        }
-        curh += tnode->getBL();
-        if (tnode->getHeight()<curh) {
-            tnode->setHeight(curh);
-        }
-    }
-}
-
-
 void BirthDeathSimulator::delete_a_node (Node * innode) {
     Node * tparent = innode->getParent();
     if (tparent != root_) {
@@ -229,7 +291,6 @@ void BirthDeathSimulator::delete_a_node (Node * innode) {
                 child = tparent->getChild(i);
             }
         tparent->removeChild(*innode);
-        tree_->setRoot(child);
         root_ = child;
     }
 }
@@ -243,15 +304,3 @@ bool BirthDeathSimulator::event_is_birth () {
         return false;
     }
 }
-
-
-double BirthDeathSimulator::get_distance_from_tip (Node *innode) {
-    Node * cur = innode;
-    double curh = 0.0;
-    while (cur->hasParent()) {
-        curh += cur->getBL();
-        cur = cur->getParent();
-    }
-    curh += cur->getBL();
-    return curh;
-}
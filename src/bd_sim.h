@@ -2,6 +2,7 @@
 #define _BD_SIM_H_
 
 #include <vector>
+#include <string>
 #include <random>
 
 class Tree; // forward declaration
@@ -19,12 +20,17 @@ private:
     double timestop_;
     int numofchanges_;
     double currenttime_;
+    int seed_;
     std::vector<Node*> extantnodes_;
     std::vector<Node*> dead_nodes_;
-    std::map<Node*, double> BIRTHTIME_;
-    std::map<Node*, double> DEATHTIME_;
+    // nodes are handed out from pool_ (in order, from the start for each
+    // tree) and kept for the next tree. a node's number is its place in the
+    // pool, which indexes its birth and death times
+    std::vector<Node*> pool_;
+    int pool_used_;
+    std::vector<double> birth_time_;
+    std::vector<double> death_time_;
     Node* root_;
-    Tree* tree_;
     
     std::mt19937 generator_;
     std::uniform_real_distribution<double> uniformDistrib_;
@@ -38,15 +44,18 @@ private:
     void setup_parameters ();
     bool event_is_birth ();
     void delete_a_node (Node *);
-    double get_distance_from_tip (Node *innode);
-    void set_distance_to_tip ();
+    Node * new_node ();
+    void simulate ();
+    void get_tips (Node * innode, double height, std::vector<Node*>& tips,
+        std::vector<double>& heights);
 
 public:
     BirthDeathSimulator ();
     BirthDeathSimulator (const double& estop, const double& tstop, const double& brate,
         const double& drate, const int& seed);
-    Tree * make_tree (const bool& show_dead);
-    //~BirthDeathSimulator();
+    void set_replicate (const int& replicate);
+    std::string make_newick (const bool& show_dead);
+    ~BirthDeathSimulator ();
 };
 
 #endif /* _BD_SIM_H_ */
@@ -0,0 +1,589 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+#ifdef OMP
+#include <omp.h>
+#endif
+
+#include "bipartition.h"
+#include "node.h"
+#include "tree.h"
+
+
+Bipartition::Bipartition () {}
+
+
+void Bipartition::trim () {
+    while (!words_.empty() && words_.back() == 0) {
+        words_.pop_back();
+    }
+}
+
+
+void Bipartition::set (const int& i) {
+    size_t w = (size_t)i >> 6;
+    if (w >= words_.size()) {
+        words_.resize(w + 1, 0);
+    }
+    words_[w] |= (uint64_t)1 << (i & 63);
+}
+
+
+bool Bipartition::test (const int& i) const {
+    size_t w = (size_t)i >> 6;
+    if (w >= words_.size()) {
+        return false;
+    }
+    return (words_[w] >> (i & 63)) & 1;
+}
+
+
+bool Bipartition::empty () const {
+    return words_.empty();
+}
+
+
+int Bipartition::count () const {
+    int c = 0;
+    for (unsigned int i = 0; i < words_.size(); i++) {
+        c += __builtin_popcountll(words_[i]);
+    }
+    return c;
+}
+
+
+// index of the lowest taxon in the set, -1 if empty
+int Bipartition::lowest () const {
+    for (unsigned int i = 0; i < words_.size(); i++) {
+        if (words_[i] != 0) {
+            return (int)(i * 64) + __builtin_ctzll(words_[i]);
+        }
+    }
+    return -1;
+}
+
+
+// taxon indices in increasing order
+std::vector<int> Bipartition::get_indices () const {
+    std::vector<int> res;
+    for (unsigned int i = 0; i < words_.size(); i++) {
+        uint64_t w = words_[i];
+        while (w != 0) {
+            res.push_back((int)(i * 64) + __builtin_ctzll(w));
+            w &= w - 1;
+        }
+    }
+    return res;
+}
+
+
+void Bipartition::unite (const Bipartition& other) {
+    if (other.words_.size() > words_.size()) {
+        words_.resize(other.words_.size(), 0);
+    }
+    for (unsigned int i = 0; i < other.words_.size(); i++) {
+        words_[i] |= other.words_[i];
+    }
+}
+
+
+Bipartition Bipartition::intersection (const Bipartition& other) const {
+    Bipartition res;
+    size_t n = std::min(words_.size(), other.words_.size());
+    res.words_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        res.words_[i] = words_[i] & other.words_[i];
+    }
+    res.trim();
+    return res;
+}
+
+
+// members of this set that are not in other
+Bipartition Bipartition::difference (const Bipartition& other) const {
+    Bipartition res = *this;
+    size_t n = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < n; i++) {
+        res.words_[i] &= ~other.words_[i];
+    }
+    res.trim();
+    return res;
+}
+
+
+bool Bipartition::intersects (const Bipartition& other) const {
+    size_t n = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < n; i++) {
+        if ((words_[i] & other.words_[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool Bipartition::is_subset_of (const Bipartition& other) const {
+    if (words_.size() > other.words_.size()) {
+        return false; // trimmed, so the last word is nonzero
+    }
+    for (unsigned int i = 0; i < words_.size(); i++) {
+        if ((words_[i] & ~other.words_[i]) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// rooted (clade) conflict: overlapping, but neither nested in the other
+bool Bipartition::conflicts_with (const Bipartition& other) const {
+    return intersects(other) && !is_subset_of(other) && !other.is_subset_of(*this);
+}
+
+
+/*
+ * unrooted (edge) conflict: as above, but two splits whose sides together
+ * cover all of the taxa are also compatible
+ */
+bool Bipartition::conflicts_with_unrooted (const Bipartition& other,
+        const Bipartition& all) const {
+    if (!conflicts_with(other)) {
+        return false;
+    }
+    Bipartition un = *this;
+    un.unite(other);
+    return un != all;
+}
+
+
+size_t Bipartition::hash () const {
+    // FNV-1a over the words
+    uint64_t h = 1469598103934665603ULL;
+    for (unsigned int i = 0; i < words_.size(); i++) {
+        h ^= words_[i];
+        h *= 1099511628211ULL;
+        h ^= h >> 29;
+    }
+    return (size_t)h;
+}
+
+
+bool Bipartition::operator== (const Bipartition& other) const {
+    return words_ == other.words_;
+}
+
+
+bool Bipartition::operator!= (const Bipartition& other) const {
+    return words_ != other.words_;
+}
+
+
+BipartitionTable::BipartitionTable (const bool& edgewise):edgewise_(edgewise),
+        use_cutoff_(false), cutoff_(0.0), num_trees_(0) {}
+
+
+// skip edges whose support (stored as the node name) is missing or below the cutoff
+void BipartitionTable::set_cutoff (const double& cutoff) {
+    use_cutoff_ = true;
+    cutoff_ = cutoff;
+}
+
+
+// returns the index of the taxon, adding it if it has not been seen before
+int BipartitionTable::add_name (const std::string& name) {
+    std::unordered_map<std::string, int>::const_iterator it = name_index_.find(name);
+    if (it != name_index_.end()) {
+        return it->second;
+    }
+    int idx = (int)names_.size();
+    name_index_[name] = idx;
+    names_.push_back(name);
+    taxon_counts_.push_back(0);
+    taxon_bl_sums_.push_back(0.0);
+    all_taxa_.set(idx);
+    return idx;
+}
+
+
+void BipartitionTable::add_names (Tree * tr) {
+    for (int i = 0; i < tr->getExternalNodeCount(); i++) {
+        add_name(tr->getExternalNode(i)->getName());
+    }
+}
+
+
+bool BipartitionTable::passes_cutoff (Node * nd) {
+    if (!use_cutoff_) {
+        return true;
+    }
+    std::string sup = nd->getName();
+    if (sup.length() < 1) {
+        return false;
+    }
+    char * pEnd;
+    double td = strtod(sup.c_str(), &pEnd);
+    return td >= cutoff_;
+}
+
+
+Bipartition BipartitionTable::canonical (const Bipartition& side,
+        const Bipartition& tree_taxa) const {
+    if (!edgewise_ || side.test(tree_taxa.lowest())) {
+        return side;
+    }
+    return tree_taxa.difference(side);
+}
+
+
+// row of a split, adding an empty one if it is new
+int BipartitionTable::get_row (const Bipartition& key, const Bipartition& side,
+        const Bipartition& other) {
+    std::unordered_map<Bipartition, int, BipartitionHasher>::const_iterator it = index_.find(key);
+    if (it != index_.end()) {
+        return it->second;
+    }
+    int idx = (int)biparts_.size();
+    index_[key] = idx;
+    biparts_.push_back(side);
+    biparts2_.push_back(other);
+    counts_.push_back(0.0);
+    bl_sums_.push_back(0.0);
+    tree_counts_.push_back(0);
+    last_tree_.push_back(-1);
+    return idx;
+}
+
+
+int BipartitionTable::add_split (const Bipartition& side, const Bipartition& other,
+        const Bipartition& key, const double& bl, const int& treeid,
+        std::vector<int>& tree_splits) {
+    int idx = get_row(key, side, other);
+    // the two halves of an edgewise root edge both add to its length
+    bl_sums_[idx] += bl;
+    bool first_in_tree = (last_tree_[idx] != treeid);
+    // edgewise splits can be reached from either side of the root edge
+    if (!edgewise_ || first_in_tree) {
+        counts_[idx] += 1;
+    }
+    if (first_in_tree) {
+        tree_counts_[idx] += 1;
+        last_tree_[idx] = treeid;
+        tree_splits.push_back(idx);
+    }
+    return idx;
+}
+
+
+/*
+ * tally the splits of one tree in a single postorder pass: the taxon set of a
+ * node is the union of those of its children. returns the (sorted, unique)
+ * rows present in the tree
+ */
+std::vector<int> BipartitionTable::add_tree (Tree * tr) {
+    add_names(tr);
+    int treeid = num_trees_++;
+    int ntips = tr->getExternalNodeCount();
+    Bipartition tree_taxa;
+    for (int i = 0; i < ntips; i++) {
+        Node * tip = tr->getExternalNode(i);
+        int idx = name_index_[tip->getName()];
+        tree_taxa.set(idx);
+        taxon_bl_sums_[idx] += tip->getBL();
+    }
+    std::vector<int> tree_idx = tree_taxa.get_indices();
+    for (unsigned int i = 0; i < tree_idx.size(); i++) {
+        taxon_counts_[tree_idx[i]]++;
+    }
+    std::vector<int> tree_splits;
+    Node * root = tr->getRoot();
+    bool unrooted = root->getChildCount() > 2;
+
+    // clades of the internal nodes, filled in postorder
+    std::unordered_map<Node *, Bipartition> clades;
+    for (int j = 0; j < tr->getInternalNodeCount(); j++) {
+        Node * nd = tr->getInternalNode(j);
+        Bipartition clade;
+        for (int k = 0; k < nd->getChildCount(); k++) {
+            Node * ch = nd->getChild(k);
+            if (ch->isExternal()) {
+                clade.set(name_index_[ch->getName()]);
+            } else {
+                clade.unite(clades[ch]);
+            }
+        }
+        int csize = clade.count();
+        clades[nd] = clade;
+        // skip the root
+        if (csize == ntips) {
+            continue;
+        }
+        if (!passes_cutoff(nd)) {
+            continue;
+        }
+        Bipartition other = tree_taxa.difference(clade);
+        if (!edgewise_) {
+            add_split(clade, other, clade, nd->getBL(), treeid, tree_splits);
+            // do the other side for unrooted
+            if (unrooted && nd->getParent() == root) {
+                add_split(other, clade, other, nd->getBL(), treeid, tree_splits);
+            }
+        } else {
+            // both sides need at least two taxa
+            if (csize < 2 || (ntips - csize) < 2) {
+                continue;
+            }
+            add_split(clade, other, canonical(clade, tree_taxa), nd->getBL(), treeid,
+                tree_splits);
+        }
+    }
+    std::sort(tree_splits.begin(), tree_splits.end());
+    return tree_splits;
+}
+
+
+/*
+ * tally a set of trees. with more than one thread, each thread fills its own
+ * copy of the (empty) table for a contiguous range of trees, and the copies
+ * are merged back in order, so the result is identical to the serial run
+ * (apart from the last bits of the summed edge lengths, which are added in a
+ * different order). returns the rows present in each tree
+ */
+std::vector<std::vector<int> > BipartitionTable::add_trees (std::vector<Tree *>& trees,
+        const int& nthreads) {
+    int ntrees = (int)trees.size();
+    std::vector<std::vector<int> > tree_splits(ntrees);
+    // names first, so that all threads share the same taxon indices
+    for (int i = 0; i < ntrees; i++) {
+        add_names(trees[i]);
+    }
+    int nt = std::max(1, std::min(nthreads, ntrees));
+#ifndef OMP
+    nt = 1;
+#endif
+    if (nt == 1) {
+        for (int i = 0; i < ntrees; i++) {
+            tree_splits[i] = add_tree(trees[i]);
+        }
+        return tree_splits;
+    }
+    BipartitionTable empty(edgewise_);
+    empty.use_cutoff_ = use_cutoff_;
+    empty.cutoff_ = cutoff_;
+    for (unsigned int i = 0; i < names_.size(); i++) {
+        empty.add_name(names_[i]);
+    }
+    std::vector<BipartitionTable> tables(nt, empty);
+#ifdef OMP
+    omp_set_num_threads(nt);
+#endif
+    #pragma omp parallel for schedule(static, 1)
+    for (int t = 0; t < nt; t++) {
+        int start = (int)((long)ntrees * t / nt);
+        int stop = (int)((long)ntrees * (t + 1) / nt);
+        for (int i = start; i < stop; i++) {
+            tree_splits[i] = tables[t].add_tree(trees[i]);
+        }
+    }
+    for (int t = 0; t < nt; t++) {
+        std::vector<int> rows = merge(tables[t]);
+        int start = (int)((long)ntrees * t / nt);
+        int stop = (int)((long)ntrees * (t + 1) / nt);
+        for (int i = start; i < stop; i++) {
+            for (unsigned int j = 0; j < tree_splits[i].size(); j++) {
+                tree_splits[i][j] = rows[tree_splits[i][j]];
+            }
+            std::sort(tree_splits[i].begin(), tree_splits[i].end());
+        }
+        tables[t] = BipartitionTable(edgewise_); // free as we go
+    }
+    return tree_splits;
+}
+
+
+/*
+ * add the tallies of another table (e.g., filled by another thread) to this
+ * one. rows new to this table are appended in the order of the other table.
+ * returns the row in this table of each row of the other
+ */
+std::vector<int> BipartitionTable::merge (const BipartitionTable& other) {
+    std::vector<int> taxmap(other.names_.size());
+    bool same_taxa = true;
+    for (unsigned int i = 0; i < other.names_.size(); i++) {
+        taxmap[i] = add_name(other.names_[i]);
+        taxon_counts_[taxmap[i]] += other.taxon_counts_[i];
+        taxon_bl_sums_[taxmap[i]] += other.taxon_bl_sums_[i];
+        if (taxmap[i] != (int)i) {
+            same_taxa = false;
+        }
+    }
+    std::vector<int> rows(other.biparts_.size());
+    for (unsigned int i = 0; i < other.biparts_.size(); i++) {
+        Bipartition side;
+        Bipartition side2;
+        if (same_taxa) {
+            side = other.biparts_[i];
+            side2 = other.biparts2_[i];
+        } else {
+            std::vector<int> idx = other.biparts_[i].get_indices();
+            for (unsigned int j = 0; j < idx.size(); j++) {
+                side.set(taxmap[idx[j]]);
+            }
+            idx = other.biparts2_[i].get_indices();
+            for (unsigned int j = 0; j < idx.size(); j++) {
+                side2.set(taxmap[idx[j]]);
+            }
+        }
+        Bipartition tree_taxa = side;
+        tree_taxa.unite(side2);
+        int idx = get_row(canonical(side, tree_taxa), side, side2);
+        counts_[idx] += other.counts_[i];
+        bl_sums_[idx] += other.bl_sums_[i];
+        tree_counts_[idx] += other.tree_counts_[i];
+        rows[i] = idx;
+    }
+    num_trees_ += other.num_trees_;
+    return rows;
+}
+
+
+int BipartitionTable::get_index (const std::string& name) const {
+    std::unordered_map<std::string, int>::const_iterator it = name_index_.find(name);
+    if (it == name_index_.end()) {
+        return -1;
+    }
+    return it->second;
+}
+
+
+// taxa that are absent from at least one of the trees
+std::vector<std::string> BipartitionTable::get_partial_names () const {
+    std::vector<std::string> nms;
+    for (unsigned int i = 0; i < names_.size(); i++) {
+        if (taxon_counts_[i] < num_trees_) {
+            nms.push_back(names_[i]);
+        }
+    }
+    return nms;
+}
+
+
+// number of trees containing the taxon
+int BipartitionTable::get_taxon_tree_count (const int& i) const {
+    return taxon_counts_[i];
+}
+
+
+// summed length of the terminal edge of the taxon over all trees
+double BipartitionTable::get_taxon_bl_sum (const int& i) const {
+    return taxon_bl_sums_[i];
+}
+
+
+// taxa below a node. names not in the table are ignored
+Bipartition BipartitionTable::get_clade (Node * nd) const {
+    Bipartition clade;
+    std::vector<std::string> nms = nd->get_leave_names();
+    for (unsigned int i = 0; i < nms.size(); i++) {
+        int idx = get_index(nms[i]);
+        if (idx >= 0) {
+            clade.set(idx);
+        }
+    }
+    return clade;
+}
+
+
+// row of a split given either side (edgewise) or the clade (nodewise). -1 if absent
+int BipartitionTable::find (const Bipartition& side) const {
+    Bipartition key = side;
+    if (edgewise_ && !side.test(all_taxa_.lowest())) {
+        key = all_taxa_.difference(side);
+    }
+    std::unordered_map<Bipartition, int, BipartitionHasher>::const_iterator it = index_.find(key);
+    if (it == index_.end()) {
+        return -1;
+    }
+    return it->second;
+}
+
+
+int BipartitionTable::find_clade (Node * nd) const {
+    return find(get_clade(nd));
+}
+
+
+bool BipartitionTable::is_edgewise () const {
+    return edgewise_;
+}
+
+
+int BipartitionTable::get_num_trees () const {
+    return num_trees_;
+}
+
+
+int BipartitionTable::get_num_taxa () const {
+    return (int)names_.size();
+}
+
+
+int BipartitionTable::get_num_biparts () const {
+    return (int)biparts_.size();
+}
+
+
+const std::vector<std::string>& BipartitionTable::get_names () const {
+    return names_;
+}
+
+
+const Bipartition& BipartitionTable::get_all_taxa () const {
+    return all_taxa_;
+}
+
+
+std::vector<std::string> BipartitionTable::get_names (const Bipartition& bp) const {
+    std::vector<std::string> nms;
+    std::vector<int> idx = bp.get_indices();
+    for (unsigned int i = 0; i < idx.size(); i++) {
+        nms.push_back(names_[idx[i]]);
+    }
+    return nms;
+}
+
+
+const Bipartition& BipartitionTable::get_bipart (const int& i) const {
+    return biparts_[i];
+}
+
+
+const Bipartition& BipartitionTable::get_bipart2 (const int& i) const {
+    return biparts2_[i];
+}
+
+
+double BipartitionTable::get_count (const int& i) const {
+    return counts_[i];
+}
+
+
+// summed length of the edge over all of the times it was encountered
+double BipartitionTable::get_bl_sum (const int& i) const {
+    return bl_sums_[i];
+}
+
+
+int BipartitionTable::get_tree_count (const int& i) const {
+    return tree_counts_[i];
+}
+
+
+bool BipartitionTable::conflicts (const int& i, const int& j) const {
+    if (edgewise_) {
+        return biparts_[i].conflicts_with_unrooted(biparts_[j], all_taxa_);
+    }
+    return biparts_[i].conflicts_with(biparts_[j]);
+}
@@ -0,0 +1,124 @@
+#ifndef _BIPARTITION_H_
+#define _BIPARTITION_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+class Tree; // forward declaration
+class Node; // forward declaration
+
+
+/*
+ * a set of taxa packed into 64-bit words, indexed by the taxon index of a
+ * BipartitionTable. trailing zero words are always trimmed so that sets built
+ * before and after new taxa are added still compare (and hash) equal
+ */
+class Bipartition {
+private:
+    std::vector<uint64_t> words_;
+
+    void trim ();
+
+public:
+    Bipartition ();
+
+    void set (const int& i);
+    bool test (const int& i) const;
+    bool empty () const;
+    int count () const;
+    int lowest () const;
+    std::vector<int> get_indices () const;
+
+    void unite (const Bipartition& other);
+    Bipartition intersection (const Bipartition& other) const;
+    Bipartition difference (const Bipartition& other) const;
+
+    bool intersects (const Bipartition& other) const;
+    bool is_subset_of (const Bipartition& other) const;
+    bool conflicts_with (const Bipartition& other) const;
+    bool conflicts_with_unrooted (const Bipartition& other, const Bipartition& all) const;
+
+    size_t hash () const;
+    bool operator== (const Bipartition& other) const;
+    bool operator!= (const Bipartition& other) const;
+};
+
+
+struct BipartitionHasher {
+    size_t operator() (const Bipartition& bp) const {
+        return bp.hash();
+    }
+};
+
+
+/*
+ * tallies the splits of a set of trees in a hash table keyed on the canonical
+ * packed bitset of each split. nodewise (rooted) splits are keyed on the
+ * clade; edgewise (unrooted) splits are keyed on the side that contains the
+ * lowest-indexed taxon of the tree, which assumes all taxa are present in all
+ * trees. rows are kept in the order they were first seen
+ */
+class BipartitionTable {
+private:
+    bool edgewise_;
+    bool use_cutoff_;
+    double cutoff_;
+    int num_trees_;
+
+    std::vector<std::string> names_; // taxon index -> name
+    std::unordered_map<std::string, int> name_index_;
+    std::vector<int> taxon_counts_; // number of trees containing each taxon
+    std::vector<double> taxon_bl_sums_; // summed terminal edge lengths
+    Bipartition all_taxa_;
+
+    std::unordered_map<Bipartition, int, BipartitionHasher> index_; // canonical split -> row
+    std::vector<Bipartition> biparts_; // first side, as first encountered
+    std::vector<Bipartition> biparts2_; // second side, as first encountered
+    std::vector<double> counts_; // number of times encountered
+    std::vector<double> bl_sums_; // summed edge lengths
+    std::vector<int> tree_counts_; // number of trees containing the split
+    std::vector<int> last_tree_; // to only count a split once per tree
+
+    bool passes_cutoff (Node * nd);
+    Bipartition canonical (const Bipartition& side, const Bipartition& tree_taxa) const;
+    int get_row (const Bipartition& key, const Bipartition& side, const Bipartition& other);
+    int add_split (const Bipartition& side, const Bipartition& other,
+        const Bipartition& key, const double& bl, const int& treeid,
+        std::vector<int>& tree_splits);
+
+public:
+    BipartitionTable (const bool& edgewise);
+
+    void set_cutoff (const double& cutoff);
+    int add_name (const std::string& name);
+    void add_names (Tree * tr);
+    std::vector<int> add_tree (Tree * tr);
+    std::vector<std::vector<int> > add_trees (std::vector<Tree *>& trees, const int& nthreads);
+    std::vector<int> merge (const BipartitionTable& other);
+
+    int get_index (const std::string& name) const;
+    std::vector<std::string> get_partial_names () const;
+    int get_taxon_tree_count (const int& i) const;
+    double get_taxon_bl_sum (const int& i) const;
+    Bipartition get_clade (Node * nd) const;
+    int find (const Bipartition& side) const;
+    int find_clade (Node * nd) const;
+
+    bool is_edgewise () const;
+    int get_num_trees () const;
+    int get_num_taxa () const;
+    int get_num_biparts () const;
+    const std::vector<std::string>& get_names () const;
+    const Bipartition& get_all_taxa () const;
+    std::vector<std::string> get_names (const Bipartition& bp) const;
+    const Bipartition& get_bipart (const int& i) const;
+    const Bipartition& get_bipart2 (const int& i) const;
+    double get_count (const int& i) const;
+    double get_bl_sum (const int& i) const;
+    int get_tree_count (const int& i) const;
+    bool conflicts (const int& i, const int& j) const;
+};
+
+#endif /* _BIPARTITION_H_ */
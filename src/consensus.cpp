@@ -0,0 +1,202 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+#include "consensus.h"
+#include "bipartition.h"
+#include "node.h"
+#include "tree.h"
+
+
+ConsensusBuilder::ConsensusBuilder (const BipartitionTable& table, const std::string& method):
+        table_(table), method_(method), threshold_(0.0) {
+    if (method_ == "strict") {
+        threshold_ = 1.0;
+    } else if (method_ == "majority") {
+        threshold_ = 0.5;
+    }
+    build();
+}
+
+
+bool ConsensusBuilder::is_method (const std::string& method) {
+    return method == "strict" || method == "majority" || method == "greedy";
+}
+
+
+// the clade of a split. edgewise splits are rooted on the first taxon
+Bipartition ConsensusBuilder::get_clade (const int& row) const {
+    const Bipartition& side = table_.get_bipart(row);
+    if (!table_.is_edgewise()) {
+        return side;
+    }
+    const Bipartition& all = table_.get_all_taxa();
+    if (side.test(all.lowest())) {
+        return all.difference(side);
+    }
+    return side;
+}
+
+
+/*
+ * compatible-split insertion: find the smallest clade containing the new one,
+ * then make sure each of its children is either inside the new clade or
+ * disjoint from it. the children that are inside are moved below the new
+ * clade. returns false if the clade conflicts (or is already present)
+ */
+bool ConsensusBuilder::insert_clade (const Bipartition& clade, const int& row) {
+    int par = 0;
+    bool descending = true;
+    while (descending) {
+        descending = false;
+        for (unsigned int i = 0; i < children_[par].size(); i++) {
+            int ch = children_[par][i];
+            if (clade.is_subset_of(clades_[ch])) {
+                if (clade == clades_[ch]) {
+                    return false;
+                }
+                par = ch;
+                descending = true;
+                break;
+            }
+        }
+    }
+    std::vector<int> inside;
+    std::vector<int> outside;
+    for (unsigned int i = 0; i < children_[par].size(); i++) {
+        int ch = children_[par][i];
+        if (clades_[ch].is_subset_of(clade)) {
+            inside.push_back(ch);
+        } else if (clades_[ch].intersects(clade)) {
+            return false;
+        } else {
+            outside.push_back(ch);
+        }
+    }
+    int cl = (int)clades_.size();
+    clades_.push_back(clade);
+    rows_.push_back(row);
+    parents_.push_back(par);
+    children_.push_back(inside);
+    for (unsigned int i = 0; i < inside.size(); i++) {
+        parents_[inside[i]] = cl;
+    }
+    outside.push_back(cl);
+    children_[par] = outside;
+    return true;
+}
+
+
+void ConsensusBuilder::build () {
+    const Bipartition& all = table_.get_all_taxa();
+    clades_.push_back(all);
+    rows_.push_back(-1);
+    parents_.push_back(-1);
+    children_.push_back(std::vector<int>());
+
+    double ntrees = table_.get_num_trees();
+    std::vector<int> order;
+    for (int i = 0; i < table_.get_num_biparts(); i++) {
+        double freq = table_.get_tree_count(i) / ntrees;
+        if ((threshold_ == 1.0 && freq == 1.0) || freq > threshold_) {
+            order.push_back(i);
+        }
+    }
+    // most frequent first. ties are kept in the order the splits were found
+    std::stable_sort(order.begin(), order.end(), [this] (const int& a, const int& b) {
+        return table_.get_tree_count(a) > table_.get_tree_count(b);
+    });
+    for (unsigned int i = 0; i < order.size(); i++) {
+        Bipartition clade = get_clade(order[i]);
+        int csize = clade.count();
+        if (csize < 2 || clade == all) {
+            continue;
+        }
+        insert_clade(clade, order[i]);
+    }
+}
+
+
+int ConsensusBuilder::get_num_clades () const {
+    return (int)clades_.size() - 1;
+}
+
+
+/*
+ * children are ordered by their lowest taxon index so the same table always
+ * gives the same newick string
+ */
+Node * ConsensusBuilder::make_node (const int& cl, const std::vector<std::vector<int> >& tips) {
+    Node * nd = new Node();
+    int row = rows_[cl];
+    if (row >= 0) {
+        nd->setName(std::to_string(table_.get_tree_count(row) / (double)table_.get_num_trees()));
+        nd->setBL(table_.get_bl_sum(row) / table_.get_count(row));
+    }
+    // (lowest taxon, child). tips are stored as -(taxon + 1)
+    std::vector<std::pair<int, int> > kids;
+    for (unsigned int i = 0; i < children_[cl].size(); i++) {
+        int ch = children_[cl][i];
+        kids.push_back(std::make_pair(clades_[ch].lowest(), ch));
+    }
+    for (unsigned int i = 0; i < tips[cl].size(); i++) {
+        kids.push_back(std::make_pair(tips[cl][i], -(tips[cl][i] + 1)));
+    }
+    std::sort(kids.begin(), kids.end());
+    const std::vector<std::string>& names = table_.get_names();
+    for (unsigned int i = 0; i < kids.size(); i++) {
+        Node * ch = NULL;
+        if (kids[i].second >= 0) {
+            ch = make_node(kids[i].second, tips);
+        } else {
+            int tx = -kids[i].second - 1;
+            double bl = 0.0;
+            if (table_.get_taxon_tree_count(tx) > 0) {
+                bl = table_.get_taxon_bl_sum(tx) / table_.get_taxon_tree_count(tx);
+            }
+            ch = new Node(bl, 0, names[tx], nd);
+        }
+        nd->addChild(*ch);
+    }
+    return nd;
+}
+
+
+Tree * ConsensusBuilder::get_tree () {
+    // attach each taxon to the smallest clade containing it: visit the clades
+    // parents-first and let the deeper ones overwrite
+    std::vector<int> taxon_clade(table_.get_num_taxa(), 0);
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        int cl = stack.back();
+        stack.pop_back();
+        if (cl != 0) {
+            std::vector<int> idx = clades_[cl].get_indices();
+            for (unsigned int i = 0; i < idx.size(); i++) {
+                taxon_clade[idx[i]] = cl;
+            }
+        }
+        for (unsigned int i = 0; i < children_[cl].size(); i++) {
+            stack.push_back(children_[cl][i]);
+        }
+    }
+    std::vector<std::vector<int> > tips(clades_.size());
+    for (unsigned int i = 0; i < taxon_clade.size(); i++) {
+        tips[taxon_clade[i]].push_back((int)i);
+    }
+    Node * root = make_node(0, tips);
+    Tree * tree = new Tree(root);
+    bool has_bl = false;
+    for (int i = 0; i < tree->getNodeCount(); i++) {
+        if (tree->getNode(i)->getBL() != 0.0) {
+            has_bl = true;
+            break;
+        }
+    }
+    tree->setEdgeLengthsPresent(has_bl);
+    tree->setNodeAnnotationsPresent(false);
+    tree->setNodeNamesPresent(get_num_clades() > 0);
+    return tree;
+}
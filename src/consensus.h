@@ -0,0 +1,46 @@
+#ifndef _CONSENSUS_H_
+#define _CONSENSUS_H_
+
+#include <string>
+#include <vector>
+
+#include "bipartition.h"
+
+class Tree; // forward declaration
+class Node; // forward declaration
+
+
+/*
+ * builds strict, majority-rule, or greedy (extended majority) consensus trees
+ * from the splits tallied in a BipartitionTable. splits are inserted in
+ * order of decreasing frequency into a growing tree of compatible clades;
+ * for unrooted (edgewise) tables the clades are taken relative to the first
+ * taxon. internal nodes are labelled with the frequency of their split and
+ * all edges get the mean length of the split over the trees containing it
+ */
+class ConsensusBuilder {
+private:
+    const BipartitionTable& table_;
+    std::string method_;
+    double threshold_; // splits must be found in more than this proportion of trees
+
+    // the consensus tree while it is being built
+    std::vector<Bipartition> clades_;
+    std::vector<int> rows_; // table row of each clade; -1 for the root
+    std::vector<int> parents_;
+    std::vector<std::vector<int> > children_;
+
+    Bipartition get_clade (const int& row) const;
+    bool insert_clade (const Bipartition& clade, const int& row);
+    void build ();
+    Node * make_node (const int& cl, const std::vector<std::vector<int> >& tips);
+
+public:
+    // method is one of those accepted by is_method
+    ConsensusBuilder (const BipartitionTable& table, const std::string& method);
+    static bool is_method (const std::string& method);
+    int get_num_clades () const;
+    Tree * get_tree ();
+};
+
+#endif /* _CONSENSUS_H_ */
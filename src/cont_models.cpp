@@ -1,6 +1,9 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
 #include <armadillo>
 
 using namespace arma;
@@ -11,24 +14,169 @@ using namespace arma;
 #include "constants.h" // for PI and E
 
 
+/*
+ * what the vcv builders need from the tree, in one (preorder/postorder) pass:
+ * - order: tips in the order they are reached, as indices of
+ *   getExternalNode (the same order for a processed tree)
+ * - tip_depths: length from the root to each tip, by getExternalNode index
+ * - node_depths/blocks: for each internal node, its length from the root
+ *   and the [first, last] positions in order of the tips below each child
+ * a pair of tips in different child blocks of a node share exactly the
+ * path from the root to that node, so every off-diagonal cell is covered
+ * once by some pair of blocks
+ */
+void get_vcv_blocks (Tree * tree, std::vector<int>& order, std::vector<double>& tip_depths,
+        std::vector<double>& node_depths, std::vector<std::vector<std::pair<int, int> > >& blocks) {
+    int numlvs = tree->getExternalNodeCount();
+    std::unordered_map<Node *, int> tip_index;
+    for (int i = 0; i < numlvs; i++) {
+        tip_index[tree->getExternalNode(i)] = i;
+    }
+    order.clear();
+    tip_depths.assign(numlvs, 0.0);
+    node_depths.clear();
+    blocks.clear();
+    std::unordered_map<Node *, double> depths;
+    std::unordered_map<Node *, std::pair<int, int> > ranges;
+    // iterative, as ladder-like trees can be very deep
+    std::vector<std::pair<Node *, int> > stack;
+    stack.push_back(std::make_pair(tree->getRoot(), 0));
+    depths[tree->getRoot()] = 0.0;
+    while (!stack.empty()) {
+        Node * nd = stack.back().first;
+        int next = stack.back().second;
+        if (next < nd->getChildCount()) {
+            stack.back().second++;
+            Node * ch = nd->getChild(next);
+            depths[ch] = depths[nd] + ch->getBL();
+            stack.push_back(std::make_pair(ch, 0));
+            continue;
+        }
+        stack.pop_back();
+        if (nd->getChildCount() == 0) {
+            int pos = (int)order.size();
+            order.push_back(tip_index[nd]);
+            tip_depths[tip_index[nd]] = depths[nd];
+            ranges[nd] = std::make_pair(pos, pos);
+        } else {
+            std::vector<std::pair<int, int> > chb;
+            for (int i = 0; i < nd->getChildCount(); i++) {
+                chb.push_back(ranges[nd->getChild(i)]);
+            }
+            ranges[nd] = std::make_pair(chb.front().first, chb.back().second);
+            node_depths.push_back(depths[nd]);
+            blocks.push_back(chb);
+        }
+    }
+}
+
+
+/*
+ * calls write(row, col, depth) once for each cell on or above the diagonal
+ * (row <= col, by getExternalNode index) of the vcv. depths are found once,
+ * then each pair of tips is visited once, in whole column stretches of a
+ * child block, so the cost is O(n^2)
+ */
+template <class CellWriter>
+static void visit_vcv_cells (Tree * tree, CellWriter& write) {
+    int numlvs = tree->getExternalNodeCount();
+    std::vector<int> order;
+    std::vector<double> tip_depths;
+    std::vector<double> node_depths;
+    std::vector<std::vector<std::pair<int, int> > > blocks;
+    get_vcv_blocks(tree, order, tip_depths, node_depths, blocks);
+    for (int i = 0; i < numlvs; i++) {
+        write((uword)i, (uword)i, tip_depths[i]);
+    }
+    for (unsigned int k = 0; k < blocks.size(); k++) {
+        double d = node_depths[k];
+        for (unsigned int a = 0; a < blocks[k].size(); a++) {
+            for (unsigned int b = a + 1; b < blocks[k].size(); b++) {
+                for (int j = blocks[k][b].first; j <= blocks[k][b].second; j++) {
+                    for (int i = blocks[k][a].first; i <= blocks[k][a].second; i++) {
+                        write((uword)std::min(order[i], order[j]),
+                            (uword)std::max(order[i], order[j]), d);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+// the cell writers for the three storage layouts below
+struct FullVcvWriter {
+    mat& vcv;
+    FullVcvWriter (mat& m):vcv(m) {}
+    void operator() (const uword& r, const uword& c, const double& d) {
+        vcv(r, c) = d;
+        vcv(c, r) = d;
+    }
+};
+
+
+struct UpperVcvWriter {
+    mat& vcv;
+    UpperVcvWriter (mat& m):vcv(m) {}
+    void operator() (const uword& r, const uword& c, const double& d) {
+        vcv(r, c) = d;
+    }
+};
+
+
+struct PackedVcvWriter {
+    vec& vcv;
+    PackedVcvWriter (vec& v):vcv(v) {}
+    void operator() (const uword& r, const uword& c, const double& d) {
+        vcv(r + (c * (c + 1)) / 2) = d;
+    }
+};
+
+
+// the full (symmetric) matrix
 void calc_vcv (Tree * tree, mat& vcv) {
     int numlvs = tree->getExternalNodeCount();
     vcv = mat(numlvs, numlvs);
-    int count = 0;
-    for (int i=0; i < numlvs; i++) {
-        int count2 = 0;
-        for (int j=0; j < numlvs; j++) {
-            if (i != j) {
-                Node * a = getMRCA_forVCV(tree->getExternalNode(i), tree->getExternalNode(j));
-                double length = get_length_to_root(a);
-                vcv(count, count2) = length;
-            } else {
-                double length = get_length_to_root(tree->getExternalNode(i));
-                vcv(count, count2) = length;
-            }
-            count2 += 1;
+    FullVcvWriter write(vcv);
+    visit_vcv_cells(tree, write);
+}
+
+
+/*
+ * as calc_vcv, but only the upper triangle (row <= column) is filled; the
+ * rest is zero. this is half the writes, and is all that chol, trimatu, or
+ * symmatu need
+ */
+void calc_vcv_upper (Tree * tree, mat& vcv) {
+    int numlvs = tree->getExternalNodeCount();
+    vcv = zeros<mat>(numlvs, numlvs);
+    UpperVcvWriter write(vcv);
+    visit_vcv_cells(tree, write);
+}
+
+
+/*
+ * the upper triangle packed by columns (lapack 'U' packed storage): cell
+ * (i, j) with i <= j is at i + j(j+1)/2, for n(n+1)/2 values in all
+ */
+void calc_vcv_packed (Tree * tree, vec& vcv) {
+    int numlvs = tree->getExternalNodeCount();
+    vcv = vec(((uword)numlvs * (numlvs + 1)) / 2);
+    PackedVcvWriter write(vcv);
+    visit_vcv_cells(tree, write);
+}
+
+
+/*
+ * the full matrix from the packed storage of calc_vcv_packed
+ */
+void unpack_vcv (const vec& packed, const int& numlvs, mat& vcv) {
+    vcv = mat(numlvs, numlvs);
+    for (uword j = 0; j < (uword)numlvs; j++) {
+        for (uword i = 0; i <= j; i++) {
+            vcv(i, j) = packed(i + (j * (j + 1)) / 2);
+            vcv(j, i) = vcv(i, j);
         }
-        count += 1;
     }
 }
 
@@ -37,7 +185,7 @@ void calc_vcv (Tree * tree, mat& vcv) {
  * get the MRCA
  * this calculates the typical algorithm for MRCA
  * can be a little slow, so probably best to use
- * getMRCAFromPath_forVCV
+ * getMRCAFromPath_forVCV or, with a tree, Tree::getMRCA
  */
 Node * getMRCA_forVCV (Node * curn1, Node * curn2) {
     Node * mrca = NULL;
@@ -152,53 +300,64 @@ double norm_log_pdf_multivariate (rowvec& x, rowvec& mu, mat& sigma) {
 
 /**
  * assumes that the characters are in get_cont_char and that the 
- * results will be in assocDoubleVector as val and valse
+ * results will be in assocDoubleVector as val and valse. the nodes are
+ * numbered once (preorder, so a parent's row is known before its children)
+ * and the tip values are read into a workspace, so the normal equations are
+ * filled without any node lookups
  */
 void calc_square_change_anc_states (Tree * tree, int index) {
-    int df = 0;
+    std::vector<Node *> nodes;
+    std::vector<int> parents;
+    std::vector<std::pair<Node *, int> > stack;
+    stack.push_back(std::make_pair(tree->getRoot(), -1));
+    while (!stack.empty()) {
+        Node * nd = stack.back().first;
+        int par = stack.back().second;
+        stack.pop_back();
+        int row = (int)nodes.size();
+        nodes.push_back(nd);
+        parents.push_back(par);
+        for (int i=0; i < nd->getChildCount(); i++) {
+            stack.push_back(std::make_pair(nd->getChild(i), row));
+        }
+    }
+    int nrows = (int)nodes.size();
+    std::vector<double> tipvals(nrows, 0.0);
+    std::vector<int> nodenum(nrows, -1); // position of each internal node in the system
     int count = 0;
-    std::map<Node *, int> nodenum;
-    for (int i=0; i < tree->getInternalNodeCount(); i++) {
-        nodenum[tree->getInternalNode(i)] = count;
-        count += 1;
-        df += 1;
-        (*tree->getInternalNode(i)->getDoubleVector("val"))[index] = 0.0;
-    }
-    df -= 1;
-    mat fullMcp(df+1, df+1);
-    vec fullVcp(df+1);
+    for (int i=0; i < nrows; i++) {
+        if (nodes[i]->getChildCount() > 0) {
+            nodenum[i] = count;
+            count += 1;
+        } else {
+            tipvals[i] = (*nodes[i]->getDoubleVector("val"))[index];
+        }
+    }
+    mat fullMcp(count, count);
+    vec fullVcp(count);
     fullMcp.fill(0.0);
     fullVcp.fill(0.0);
-    calc_postorder_square_change(tree->getRoot(), nodenum, &fullMcp, &fullVcp, index);
+    for (int i=0; i < nrows; i++) {
+        if (parents[i] < 0) {
+            continue;
+        }
+        int nni = nodenum[parents[i]];
+        double tbl = 2./nodes[i]->getBL();
+        fullMcp(nni, nni) += tbl;
+        if (nodenum[i] < 0) {
+            fullVcp[nni] += tipvals[i] * tbl;
+        } else {
+            int nnj = nodenum[i];
+            fullMcp(nni, nnj) -= tbl;
+            fullMcp(nnj, nni) -= tbl;
+            fullMcp(nnj, nnj) += tbl;
+        }
+    }
     mat b = chol(fullMcp);
-    vec mle;
     mat x = solve(trimatl(b.t())*b, fullVcp);
-    count = 0;
-    for (int i=0; i < tree->getInternalNodeCount(); i++) {
-        (*tree->getInternalNode(i)->getDoubleVector("val"))[index] = x(nodenum[tree->getInternalNode(i)], 0);
-        count += 1;
-    }
-}
-
-
-void calc_postorder_square_change (Node * node, std::map<Node *, int>& nodenum,
-    mat * fullMcp, mat * fullVcp, int index) {
-    for (int i=0; i < node->getChildCount(); i++) {
-        calc_postorder_square_change(node->getChild(i), nodenum, fullMcp, fullVcp, index);    
-    }
-    if (node->getChildCount() > 0) {
-        int nni = nodenum[node];
-        for (int j=0; j < node->getChildCount(); j++) {
-            double tbl = 2./node->getChild(j)->getBL();
-            (*fullMcp)(nni, nni) += tbl;
-            if (node->getChild(j)->getChildCount() == 0) {
-                (*fullVcp)[nni] += (*node->getChild(j)->getDoubleVector("val"))[index] * tbl;
-            } else {
-                int nnj = nodenum[node->getChild(j)];
-                (*fullMcp)(nni, nnj) -= tbl;
-                (*fullMcp)(nnj, nni) -= tbl;
-                (*fullMcp)(nnj, nnj) += tbl;
-            }
+    for (int i=0; i < nrows; i++) {
+        if (nodenum[i] >= 0) {
+            (*nodes[i]->getDoubleVector("val"))[index] = x(nodenum[i], 0);
         }
     }
 }
@@ -240,3 +399,133 @@ double calc_bm_prune (Tree * tr, double sigma) {
     }
     return tlike;
 }
+
+
+ContPruner::ContPruner (Tree * tree):num_tips_(tree->getExternalNodeCount()),
+        max_depth_(0.0) {
+    std::unordered_map<Node *, int> tip_index;
+    for (int i = 0; i < num_tips_; i++) {
+        tip_index[tree->getExternalNode(i)] = i;
+    }
+    tip_node_.assign(num_tips_, -1);
+    // iterative postorder. a node's index is only known when it is left, so
+    // the parents are patched in afterwards
+    std::vector<Node *> post;
+    std::vector<std::pair<Node *, int> > stack;
+    stack.push_back(std::make_pair(tree->getRoot(), 0));
+    while (!stack.empty()) {
+        Node * nd = stack.back().first;
+        int next = stack.back().second;
+        if (next < nd->getChildCount()) {
+            stack.back().second++;
+            stack.push_back(std::make_pair(nd->getChild(next), 0));
+        } else {
+            stack.pop_back();
+            post.push_back(nd);
+        }
+    }
+    std::unordered_map<Node *, int> node_index;
+    for (unsigned int i = 0; i < post.size(); i++) {
+        node_index[post[i]] = (int)i;
+    }
+    int nnodes = (int)post.size();
+    parent_.assign(nnodes, -1);
+    bl_.assign(nnodes, 0.0);
+    depth_.assign(nnodes, 0.0);
+    for (int i = nnodes - 1; i >= 0; i--) {
+        Node * nd = post[i];
+        if (i != nnodes - 1) {
+            parent_[i] = node_index[nd->getParent()];
+            bl_[i] = nd->getBL();
+            depth_[i] = depth_[parent_[i]] + bl_[i];
+        }
+        if (nd->getChildCount() == 0) {
+            tip_node_[tip_index[nd]] = i;
+            if (depth_[i] > max_depth_) {
+                max_depth_ = depth_[i];
+            }
+        }
+    }
+}
+
+
+int ContPruner::get_num_tips () const {
+    return num_tips_;
+}
+
+
+/*
+ * log likelihood of the tip values under bm with the given rate, edge
+ * lengths, and root value. each node carries a normal density for its value
+ * (mean, variance per unit rate); sibling densities are multiplied, which
+ * contributes the density of their contrast. multifurcations and knuckles
+ * are fine. O(n)
+ */
+double ContPruner::prune (const std::vector<double>& vals, const std::vector<double>& lens,
+        const double& rate, const double& root_val) const {
+    int nnodes = (int)parent_.size();
+    std::vector<double> means(nnodes, 0.0);
+    std::vector<double> vars(nnodes, 0.0);
+    std::vector<bool> started(nnodes, false);
+    for (int i = 0; i < num_tips_; i++) {
+        means[tip_node_[i]] = vals[i];
+        started[tip_node_[i]] = true;
+    }
+    double like = 0.0;
+    for (int i = 0; i < nnodes - 1; i++) {
+        int par = parent_[i];
+        double m = means[i];
+        double v = vars[i] + lens[i];
+        if (!started[par]) {
+            means[par] = m;
+            vars[par] = v;
+            started[par] = true;
+            continue;
+        }
+        double s = vars[par] + v;
+        double u = means[par] - m;
+        like += -0.5 * (log(2 * PI * rate * s) + (u * u) / (rate * s));
+        means[par] = (means[par] * v + m * vars[par]) / s;
+        vars[par] = (vars[par] * v) / s;
+    }
+    int root = nnodes - 1;
+    if (vars[root] > 0) {
+        double u = means[root] - root_val;
+        like += -0.5 * (log(2 * PI * rate * vars[root]) + (u * u) / (rate * vars[root]));
+    }
+    return like;
+}
+
+
+double ContPruner::calc_bm_loglike (const std::vector<double>& x, const double& anc,
+        const double& rate) const {
+    return prune(x, bl_, rate, anc);
+}
+
+
+/*
+ * ou with the root and the optimum both at anc (the model of nlopt_ou_sr_log).
+ * its covariance is D W D, where D = diag(exp(-alpha * depth)) and W is bm on
+ * the same tree with node heights (exp(2 * alpha * depth) - 1) / (2 * alpha),
+ * so the tips are rescaled and pruned as bm. everything is shifted by the
+ * deepest tip so that the exponents are never positive
+ */
+double ContPruner::calc_ou_loglike (const std::vector<double>& x, const double& anc,
+        const double& rate, const double& alpha) const {
+    int nnodes = (int)parent_.size();
+    std::vector<double> lens(nnodes, 0.0);
+    for (int i = 0; i < nnodes - 1; i++) {
+        int par = parent_[i];
+        double ep = exp(2 * alpha * (depth_[par] - max_depth_));
+        lens[i] = ep * expm1(2 * alpha * bl_[i]) / (2 * alpha);
+    }
+    std::vector<double> z(num_tips_);
+    double shift = 0.0;
+    for (int i = 0; i < num_tips_; i++) {
+        double d = depth_[tip_node_[i]];
+        z[i] = exp(alpha * (d - max_depth_)) * (x[i] - anc);
+        shift += alpha * (max_depth_ - d);
+    }
+    return prune(z, lens, rate, 0.0) - shift;
+}
+
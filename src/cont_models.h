@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <map>
+#include <utility>
 #include <cmath>
 
 #include "tree.h"
@@ -17,11 +18,43 @@ double norm_pdf_multivariate (rowvec& x, rowvec& mu, mat& sigma);
 double norm_log_pdf_multivariate (rowvec& x, rowvec& mu, mat& sigma);
 Node * getMRCA_forVCV (Node * curn1,Node * curn2);
 Node * getMRCAFromPath_forVCV (std::vector<Node *> * path1,Node * curn2);
-void calc_vcv(Tree * tr, mat& vcv);
+void get_vcv_blocks (Tree * tree, std::vector<int>& order, std::vector<double>& tip_depths,
+    std::vector<double>& node_depths, std::vector<std::vector<std::pair<int, int> > >& blocks);
+void calc_vcv (Tree * tr, mat& vcv);
+void calc_vcv_upper (Tree * tr, mat& vcv);
+void calc_vcv_packed (Tree * tr, vec& vcv);
+void unpack_vcv (const vec& packed, const int& numlvs, mat& vcv);
 void calc_square_change_anc_states (Tree * tree, int index);
-void calc_postorder_square_change (Node * node, std::map<Node *, int>& nodenum,
-    mat * fullMcp, mat * fullVcp, int index);
 double calc_bm_node_postorder (Node * node, int nch, double sigma);
 double calc_bm_prune (Tree * tr, double sigma);
 
+
+/*
+ * linear-time brownian motion and ornstein-uhlenbeck likelihoods by pruning
+ * (independent contrasts carried up to the root), in place of the
+ * multivariate normal on the full vcv. the tree is flattened once so the
+ * same object can be shared by characters (and threads); tip values are
+ * given in getExternalNode order
+ */
+class ContPruner {
+private:
+    int num_tips_;
+    std::vector<int> parent_; // nodes in postorder (root last); -1 for the root
+    std::vector<double> bl_; // length of the edge above each node
+    std::vector<double> depth_; // length from the root
+    std::vector<int> tip_node_; // node of each tip
+    double max_depth_;
+
+    double prune (const std::vector<double>& vals, const std::vector<double>& lens,
+        const double& rate, const double& root_val) const;
+
+public:
+    ContPruner (Tree * tree);
+    int get_num_tips () const;
+    double calc_bm_loglike (const std::vector<double>& x, const double& anc,
+        const double& rate) const;
+    double calc_ou_loglike (const std::vector<double>& x, const double& anc,
+        const double& rate, const double& alpha) const;
+};
+
 #endif /* _CONT_MODELS_H_ */
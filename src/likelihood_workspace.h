@@ -0,0 +1,105 @@
+#ifndef _LIKELIHOOD_WORKSPACE_H_
+#define _LIKELIHOOD_WORKSPACE_H_
+
+#include <cstdlib>
+#include <new>
+
+
+/*
+ * per-node likelihood vectors (conditionals, reverse conditionals, etc.)
+ * kept in one contiguous block laid out as [node][state]. nodes are indexed
+ * by their row number (whatever numbering the user sets up, e.g. postorder).
+ * rows are padded out to whole cache lines and the block is cache-line
+ * aligned, so each node's vector starts on its own line
+ */
+template<class T>
+class LikelihoodWorkspace {
+private:
+    static const size_t CACHE_LINE = 64;
+    int num_nodes_;
+    int num_states_;
+    int stride_; // padded row length
+    T * data_;
+
+    void release () {
+        if (data_ != NULL) {
+            for (long i = 0; i < (long)num_nodes_ * stride_; i++) {
+                data_[i].~T();
+            }
+            free(data_);
+            data_ = NULL;
+        }
+    }
+
+    // not copyable (workspaces are big and owned by one reconstruction)
+    LikelihoodWorkspace (const LikelihoodWorkspace&);
+    LikelihoodWorkspace& operator= (const LikelihoodWorkspace&);
+
+public:
+    LikelihoodWorkspace ():num_nodes_(0), num_states_(0), stride_(0), data_(NULL) {}
+
+    LikelihoodWorkspace (const int& num_nodes, const int& num_states):num_nodes_(0),
+            num_states_(0), stride_(0), data_(NULL) {
+        resize(num_nodes, num_states);
+    }
+
+    ~LikelihoodWorkspace () {
+        release();
+    }
+
+    // (re)allocate; every entry is set to val
+    void resize (const int& num_nodes, const int& num_states, const T& val = T()) {
+        release();
+        num_nodes_ = num_nodes;
+        num_states_ = num_states;
+        int per_line = (int)(CACHE_LINE / sizeof(T));
+        if (per_line < 1) {
+            per_line = 1;
+        }
+        stride_ = ((num_states + per_line - 1) / per_line) * per_line;
+        size_t bytes = (size_t)num_nodes_ * stride_ * sizeof(T);
+        if (bytes == 0) {
+            return;
+        }
+        void * mem = NULL;
+        if (posix_memalign(&mem, CACHE_LINE, bytes) != 0) {
+            throw std::bad_alloc();
+        }
+        data_ = (T *) mem;
+        for (long i = 0; i < (long)num_nodes_ * stride_; i++) {
+            new (&data_[i]) T(val);
+        }
+    }
+
+    void fill (const T& val) {
+        for (long i = 0; i < (long)num_nodes_ * stride_; i++) {
+            data_[i] = val;
+        }
+    }
+
+    T * row (const int& node) {
+        return data_ + (long)node * stride_;
+    }
+
+    const T * row (const int& node) const {
+        return data_ + (long)node * stride_;
+    }
+
+    T& at (const int& node, const int& state) {
+        return data_[(long)node * stride_ + state];
+    }
+
+    const T& at (const int& node, const int& state) const {
+        return data_[(long)node * stride_ + state];
+    }
+
+    int get_num_nodes () const {
+        return num_nodes_;
+    }
+
+    int get_num_states () const {
+        return num_states_;
+    }
+};
+
+#endif /* _LIKELIHOOD_WORKSPACE_H_ */
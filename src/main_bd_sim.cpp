@@ -5,6 +5,10 @@
 #include <cstring>
 #include <getopt.h>
 
+#ifdef OMP
+#include <omp.h>
+#endif
+
 #include "node.h"
 #include "tree_reader.h"
 #include "string_node_object.h"
@@ -29,6 +33,9 @@ void print_help () {
     std::cout << " -b, --birth=DOUBLE  birth rate, default=1" << std::endl;
     std::cout << " -d, --death=DOUBLE  death rate, default=0" << std::endl;
     std::cout << " -n, --nreps=INT     number of replicates, default=1" << std::endl;
+#ifdef OMP
+    std::cout << " -T, --nthreads=INT  number of threads (open mp) for replicates, default=1" << std::endl;
+#endif
     std::cout << " -o, --outf=FILE     output file, STOUT otherwise" << std::endl;
     std::cout << " -s, --showextinct   show lineages that went extinct, default=false" << std::endl;
     std::cout << " -x, --seed=INT      random number seed, clock otherwise" << std::endl;
@@ -49,6 +56,7 @@ static struct option const long_options[] =
     {"birth", required_argument, NULL, 'b'},
     {"death", required_argument, NULL, 'd'},
     {"nreps", required_argument, NULL, 'n'},
+    {"nthreads", required_argument, NULL, 'T'},
     {"outf", required_argument, NULL, 'o'},
     {"showextinct", no_argument, NULL, 's'},
     {"seed", required_argument, NULL, 'x'},
@@ -68,6 +76,7 @@ int main(int argc, char * argv[]) {
     char * outf = NULL;
     int ext = 0;
     int nreps = 1;
+    int num_threads = 1;
     double time = 0.0;
     double birth = 1.0;
     double death = 0.0;
@@ -76,7 +85,7 @@ int main(int argc, char * argv[]) {
     int seed = -1;
     while (1) {
         int oi = -1;
-        int c = getopt_long(argc, argv, "e:t:b:d:n:o:x:shVC", long_options, &oi);
+        int c = getopt_long(argc, argv, "e:t:b:d:n:T:o:x:shVC", long_options, &oi);
         if (c == -1) {
             break;
         }
@@ -106,6 +115,9 @@ int main(int argc, char * argv[]) {
             case 'n':
                 nreps = string_to_int(optarg, "-n");
                 break;
+            case 'T':
+                num_threads = string_to_int(optarg, "-T");
+                break;
             case 'o':
                 outfileset = true;
                 outf = strdup(optarg);
@@ -150,13 +162,27 @@ int main(int argc, char * argv[]) {
         poos = &std::cout;
     }
     
-    BirthDeathSimulator bd(ext, time, birth, death, seed);
-    for (int i = 0; i < nreps; i++) {
-        Tree * bdtr = bd.make_tree(showd);
-        if (bdtr->getExtantNodeCount() > 1) {
-            (*poos) << bdtr->getRoot()->getNewick(true) << ";" << std::endl;
-        } else {
-            (*poos) << "(" << bdtr->getRoot()->getNewick(true) << ");" << std::endl;
+    // each replicate has its own random number stream, so fix a clock seed up front
+    if (seed == -1) {
+        seed = (int)(get_clock_seed() & 0x7fffffff);
+    }
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    
+    // one simulator (and so one node pool) per thread. replicates are written
+    // in order as they finish, and do not depend on the number of threads
+    #pragma omp parallel
+    {
+        BirthDeathSimulator bd(ext, time, birth, death, seed);
+        #pragma omp for ordered schedule(dynamic)
+        for (int i = 0; i < nreps; i++) {
+            bd.set_replicate(i);
+            std::string nwk = bd.make_newick(showd);
+            #pragma omp ordered
+            {
+                (*poos) << nwk << std::endl;
+            }
         }
     }
     if (outfileset) {
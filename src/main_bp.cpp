@@ -9,6 +9,7 @@
 
 #include "tree.h"
 #include "tree_reader.h"
+#include "bipartition.h"
 #include "utils.h"
 #include "log.h"
 #include "constants.h"
@@ -34,6 +35,7 @@ void print_help() {
     std::cout << " -c, --cutoff        skip biparts that have support lower than this." << std::endl;
     std::cout << " -s, --suppress      don't print all the output (maybe you use this" << std::endl;
     std::cout << "                           with the maptree feature" << std::endl;
+    std::cout << " -n, --nthreads=INT  number of threads (open mp), default=1" << std::endl;
     std::cout << " -o, --outf=FILE     output file, STOUT otherwise" << std::endl;
     std::cout << " -h, --help          display this help and exit" << std::endl;
     std::cout << " -V, --version       display version and exit" << std::endl;
@@ -55,6 +57,7 @@ static struct option const long_options[] =
     {"cutoff", required_argument, NULL, 'c'},
     {"suppress", no_argument, NULL, 's'},
     {"first", no_argument, NULL, 'f'},
+    {"nthreads", required_argument, NULL, 'n'},
     {"outf", required_argument, NULL, 'o'},
     {"help", no_argument, NULL, 'h'},
     {"version", no_argument, NULL, 'V'},
@@ -79,9 +82,10 @@ int main(int argc, char * argv[]) {
     char * mtreef = NULL;
     char * outf = NULL;
     double cutnum = 0;
+    int num_threads = 1;
     while (1) {
         int oi = -1;
-        int c = getopt_long(argc, argv, "t:o:m:c:vseufhVC", long_options, &oi);
+        int c = getopt_long(argc, argv, "t:o:m:c:n:vseufhVC", long_options, &oi);
         if (c == -1) {
             break;
         }
@@ -114,6 +118,9 @@ int main(int argc, char * argv[]) {
                 cutnum = string_to_float(optarg, "-c");
                 cutoff = true;
                 break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
             case 'm':
                 mapfileset = true;
                 mtreef = strdup(optarg);
@@ -169,41 +176,45 @@ int main(int argc, char * argv[]) {
     }
 
     //------READ TREES
-    std::string retstring;
-    int ft = test_tree_filetype_stream(*pios, retstring);
-    if (ft != 0 && ft != 1) {
-        std::cerr << "Error: this really only works with nexus or newick. Exiting." << std::endl;
-        exit(0);
+    //get the biparts for the trees. trees are read in blocks, tallied, and
+    //freed, so only the bipartition table is held in memory
+    BipartitionTable bptable(edgewisealltaxa);
+    if (cutoff == true) {
+        bptable.set_cutoff(cutnum);
     }
-
-    std::vector<Tree *> trees;
-    bool going = true;
-    if (ft == 0) {
-        std::map<std::string, std::string> translation_table;
-        bool ttexists;
-        ttexists = get_nexus_translation_table(*pios, &translation_table, &retstring);;
-        Tree * tree;
-        while (going) {
-            tree = read_next_tree_from_stream_nexus(*pios, retstring, ttexists,
-                &translation_table, &going);
-            if (tree != NULL) {
-                trees.push_back(tree);
+    TreeBlockReader reader(*pios, num_threads);
+    std::vector<Tree *> trees; // the current block
+    std::vector<int> first_biparts; // the biparts present in the first tree
+    std::vector<std::vector<int> > bipart_trees; // the trees each bipart is found in
+    std::set<std::vector<int> > un_trees;
+    std::vector<std::string> un_newicks;
+    int numtrees = 0;
+    while (reader.next_block(trees)) {
+        std::vector<std::vector<int> > tree_biparts = bptable.add_trees(trees, num_threads);
+        for (unsigned int i=0; i < trees.size(); i++) {
+            if (numtrees == 0) {
+                first_biparts = tree_biparts[i];
             }
+            if (verbose) {
+                bipart_trees.resize(bptable.get_num_biparts());
+                for (unsigned int j=0; j < tree_biparts[i].size(); j++) {
+                    bipart_trees[tree_biparts[i][j]].push_back(numtrees);
+                }
+            }
+            if (uniquetree && un_trees.insert(tree_biparts[i]).second) {
+                un_newicks.push_back(trees[i]->getRoot()->getNewick(false));
+            }
+            delete trees[i];
+            numtrees++;
         }
-    } else if (ft == 1) {
-        Tree * tree;
-        while (going) {
-            tree = read_next_tree_from_stream_newick(*pios, retstring, &going);
-            if (going) {
-                trees.push_back(tree);
-            } 
-        }
+        trees.clear();
     }
     //-----END READ TREES
     //-----READ MAP TREE
     Tree * maptree = NULL;
     if (mapfileset == true) {
-        ft = test_tree_filetype_stream(*mpios, retstring);
+        std::string retstring;
+        int ft = test_tree_filetype_stream(*mpios, retstring);
         if (ft != 0 && ft != 1) {
             std::cerr << "Error: this really only works with nexus or newick. Exiting." << std::endl;
             exit(0);
@@ -234,7 +245,6 @@ int main(int argc, char * argv[]) {
     }
     //----END READ MAP TREE
 
-    int numtrees = trees.size();
     if (numtrees == 0) {
         if (fileset) {
             fstr->close();
@@ -247,312 +257,71 @@ int main(int argc, char * argv[]) {
         std::cerr << "there are no trees;" << std::endl;
     }
     
-    //get the biparts for the trees
-    std::vector<std::string> names;
-    std::set<std::string> names_s;
-    std::map<std::string, int> name_index;
-    std::map<int, std::string> name_st_index;
-    //added to make sure we have all the names if it is partially overlapping
-    for (unsigned int t = 0; t < trees.size(); t++) {
-        for (int i=0; i < trees[t]->getExternalNodeCount(); i++) {
-            std::string tname = trees[t]->getExternalNode(i)->getName();
-            if (find(names.begin(), names.end(), tname) == names.end()) {
-                name_index[tname] = i;
-                names.push_back(tname);
-                name_st_index[i] = tname;
-            }
-        }
-    }
-    copy(names.begin(), names.end(), inserter(names_s, names_s.begin()));
-
-    std::vector<std::vector<int> > biparts; // first part of the bipart
-    std::vector<std::vector<int> > biparts2; // second part of the bipart
-    std::vector<std::vector<int> > not_included; // the names that aren't in the tree
-    std::vector<double> bp_count;
-    for (int i=0; i < numtrees; i++) {
-        //get the biparts
-        bool unrooted = false;
-        int numch = trees[i]->getRoot()->getChildCount();
-        if (numch > 2) {
-            unrooted = true;
-        }
-        std::vector<std::string> rt_nms = trees[i]->getRoot()->get_leave_names();
-        std::set<std::string> rt_nms_set;
-        copy(rt_nms.begin(), rt_nms.end(), inserter(rt_nms_set, rt_nms_set.begin()));
-        //get the ones that aren't in the tree at all
-        std::vector<std::string> not_included_nms(rt_nms_set.size());
-        std::vector<int> not_included_i;
-        std::vector<std::string>::iterator it2;
-        it2 = std::set_difference(names_s.begin(), names_s.end(), rt_nms_set.begin(),
-                rt_nms_set.end(), not_included_nms.begin());
-        not_included_nms.resize(it2-not_included_nms.begin());
-        for (unsigned int j=0; j < not_included_nms.size(); j++) {
-            std::cerr << " not included: "  << not_included_nms[j]<< std::endl;
-            not_included_i.push_back(name_index[not_included_nms[j]]);
-        }
-        std::vector<int> bp_count_tree; // for edgewise to make sure we don't double count
-        for (int j=0; j < trees[i]->getInternalNodeCount(); j++) {
-            std::vector<std::string> nms = trees[i]->getInternalNode(j)->get_leave_names();
-            //skip the root
-            if (nms.size() == rt_nms.size()) {
-                continue;
-            }
-            //if we are using a cutoff, skip the edge that is below the num
-            if (cutoff == true) {
-                if (trees[i]->getInternalNode(j)->getName().length() < 1) {
-                    continue;
-                }
-                char* pEnd;
-                double td = strtod(trees[i]->getInternalNode(j)->getName().c_str(),&pEnd) ;
-                if (td < cutnum) {
-                    continue;
-                }
-            }
-            //end using cutoffs
-            std::vector<int> nms_i;
-            std::set<std::string> nms_s;
-            copy(nms.begin(), nms.end(), inserter(nms_s, nms_s.begin()));
-            for (unsigned int k=0; k < nms.size(); k++) {
-                nms_i.push_back(name_index[nms[k]]);
-            }
-            sort(nms_i.begin(), nms_i.end());
-            //get the other side of the bipart
-            std::vector<int> nms_i2;
-            std::vector<std::string> nms_s2(rt_nms.size());
-            std::vector<std::string>::iterator it;
-            it = std::set_difference(rt_nms_set.begin(), rt_nms_set.end(), nms_s.begin(),
-                nms_s.end(), nms_s2.begin());
-            nms_s2.resize(it-nms_s2.begin());
-            for (unsigned int k=0; k < nms_s2.size(); k++) {
-                nms_i2.push_back(name_index[nms_s2[k]]);
-            }
-            sort(nms_i2.begin(), nms_i2.end());
-            //check to see if the bipart is new
-            if (edgewisealltaxa == false) {
-                //this is nodewise and we dont' assume we have all the taxa
-                if ((int)std::count(biparts.begin(), biparts.end(), nms_i) == 0 && 
-                (int)std::count(biparts2.begin(), biparts2.end(), nms_i2) == 0) {
-                    biparts.push_back(nms_i);
-                    biparts2.push_back(nms_i2);
-                    not_included.push_back(not_included_i);
-                    bp_count.push_back(1);
-                } else {
-                    //get index 
-                    size_t index = find(biparts.begin(), biparts.end(), nms_i)-biparts.begin();
-                    bp_count[index] += 1;
-                }
-                /*
-                 * do the otherside for unrooted
-                 */
-                if (unrooted==true && trees[i]->getInternalNode(j)->getParent()==trees[i]->getRoot()) {
-                    if ((int)std::count(biparts.begin(), biparts.end(), nms_i2) == 0 && 
-                        (int)std::count(biparts2.begin(), biparts2.end(), nms_i) == 0) {
-                        biparts.push_back(nms_i2);
-                        biparts2.push_back(nms_i);
-                        not_included.push_back(not_included_i);
-                        bp_count.push_back(1);
-                    } else {
-                        size_t index = find(biparts.begin(), biparts.end(), nms_i2)-biparts.begin();
-                        bp_count[index] += 1;
-                    }
-                }
-            } else {
-                //this is edgewise and we assume all the taxa 
-                //this is for reporting a b | c d instead of a b and c d separately
-                
-                //first check to make sure that both sides at least have two taxa
-                if (nms_i.size() < 2 || nms_i2.size() < 2) {
-                    continue;
-                }
-                if ((int)std::count(biparts.begin(), biparts.end(), nms_i) == 0 && 
-                    (int)std::count(biparts.begin(), biparts.end(), nms_i2) == 0) {
-                    biparts.push_back(nms_i);
-                    biparts2.push_back(nms_i2);
-                    not_included.push_back(not_included_i);
-                    bp_count.push_back(1);
-                    bp_count_tree.push_back(bp_count.size()-1);
-                } else {
-                    //get index 
-                    size_t index;
-                    if ((int)std::count(biparts.begin(), biparts.end(), nms_i) == 1) {
-                        index = find(biparts.begin(), biparts.end(), nms_i)-biparts.begin();
-                    } else {
-                        index = find(biparts.begin(), biparts.end(), nms_i2)-biparts.begin();
-                    }
-                    //need to accommodate that it can be reflected in the edgewise case
-                    if ((int)std::count(bp_count_tree.begin(), bp_count_tree.end(), index) == 0) {
-                        bp_count[index] += 1;
-                        bp_count_tree.push_back(index);
-                    }
-                }
-
-            }
-        }
+    //names that are not in every tree
+    std::vector<std::string> not_included_nms = bptable.get_partial_names();
+    for (unsigned int j=0; j < not_included_nms.size(); j++) {
+        int ntr = bptable.get_taxon_tree_count(bptable.get_index(not_included_nms[j]));
+        std::cerr << " not included: "  << not_included_nms[j] << " (missing from "
+            << (numtrees - ntr) << " trees)" << std::endl;
     }
+    int numbiparts = bptable.get_num_biparts();
     if (suppress == false) {
         (*poos) << numtrees << " trees " <<  std::endl;
-        (*poos) << biparts.size() << " unique clades found" << std::endl;
-        //calculate the logical matrix of biparts for each tree
-        //the matrix will have each i as a tree and 
-        //   each matrix[i] will represent a 1 if the tree has the bipart and 0 if not
-        int colsize = biparts.size()+1;
-        if (edgewisealltaxa == true) {
-            colsize = biparts.size(); //no root for edgewise
-        }
-        std::vector<int> cols(colsize, 0);
-        std::vector<std::vector<int> > matrix (numtrees, cols);
-        for (int i=0; i < numtrees; i++) {
-            bool unrooted = false;
-            int numch = trees[i]->getRoot()->getChildCount();
-            if (numch > 2) {
-                unrooted = true;
-            }
-            for (int j=0; j < trees[i]->getInternalNodeCount(); j++) {
-                //if we are using a cutoff, skip the edge that is below the num
-                if (cutoff == true) {
-                    if (trees[i]->getInternalNode(j)->getName().length() < 1) {
-                        continue;
-                    }
-                    char* pEnd;
-                    double td = strtod(trees[i]->getInternalNode(j)->getName().c_str(),&pEnd) ;
-                    if (td < cutnum) {
-                        continue;
-                    }
-                }
-                //end using cutoffs
-                //should this do the root? I don't think so
-                if (edgewisealltaxa == true && trees[i]->getInternalNode(j)==trees[i]->getRoot()) {
-                    continue;
-                }
-
-                std::vector<std::string> nms = trees[i]->getInternalNode(j)->get_leave_names();
-                std::vector<int> nms_i;
-                for (unsigned int k=0; k < nms.size(); k++) {
-                    nms_i.push_back(name_index[nms[k]]);
-                }
-                sort(nms_i.begin(), nms_i.end());
-                size_t index;
-                if (edgewisealltaxa == true) {
-                    if ((int)std::count(biparts.begin(), biparts.end(), nms_i) == 1) {
-                        index = find(biparts.begin(), biparts.end(), nms_i)-biparts.begin();
-                    } else {
-                        index = find(biparts2.begin(), biparts2.end(), nms_i)-biparts2.begin();
-                    } 
-                } else {
-                    index = find(biparts.begin(), biparts.end(), nms_i) - biparts.begin();
-                }
-                matrix[i][index] = 1;
-                if (unrooted==true && trees[i]->getInternalNode(j)->getParent()==trees[i]->getRoot()) {
-                    std::vector<std::string> rt_nms = trees[i]->getRoot()->get_leave_names();
-                    std::set<std::string> rt_nms_set;
-                    copy(rt_nms.begin(), rt_nms.end(), inserter(rt_nms_set, rt_nms_set.begin()));
-                    std::set<std::string> nms_s;
-                    copy(nms.begin(), nms.end(), inserter(nms_s, nms_s.begin()));
-                    std::vector<int> nms_i;
-                    std::vector<int> nms_i2;
-                    std::vector<std::string> nms_s2(rt_nms.size());
-                    std::vector<std::string>::iterator it;
-                    it = std::set_difference(rt_nms_set.begin(), rt_nms_set.end(), nms_s.begin(), nms_s.end(), nms_s2.begin());
-                    nms_s2.resize(it-nms_s2.begin());
-                    for (unsigned int k=0; k < nms_s2.size(); k++) {
-                        nms_i2.push_back(name_index[nms_s2[k]]);
-                    }
-                    for (auto it : nms_s) {
-                        nms_i.push_back(name_index[it]);
-                    }
-                    sort(nms_i2.begin(), nms_i2.end());
-                    sort(nms_i.begin(), nms_i.end());
-                    int x = find(biparts.begin(), biparts.end(), nms_i2) - biparts.begin();
-                    if (x == (int)matrix[i].size()) {
-                        x = find(biparts.begin(), biparts.end(), nms_i)-biparts.begin();
-                    }
-                    matrix[i][x] = 1;
-                }
-            }
-        }
+        (*poos) << numbiparts << " unique clades found" << std::endl;
         /*
          * print the unique trees
          */
         if (uniquetree == true) {
             std::cout << "====UNIQUE TREES====" << std::endl;
-            std::set<std::string> un_trees;
-            for (int i=0; i <numtrees; i++) {
-                std::string sv = get_string_vector(matrix[i]);
-                if (count(un_trees.begin(), un_trees.end(), sv)==0) {
-                    std::cout << trees[i]->getRoot()->getNewick(false) << ";" << std::endl;
-                    un_trees.insert(sv);
-                }
+            for (unsigned int i=0; i < un_newicks.size(); i++) {
+                std::cout << un_newicks[i] << ";" << std::endl;
             }
             std::cout << "==END UNIQUE TREES==" << std::endl;
             exit(0);
         }
-
-        //constructing the logical matrix
-        //the logical matrix has each row as a bipart1 and each col as a name
-        //there is a one if the bipart has the name
-        //need to add the -1 for bipart2
-        std::vector<int> cols2(names.size(), 0);
-        std::vector<std::vector<int> > logical_matrix (biparts.size(), cols2);
-        for (unsigned int i=0; i < biparts.size(); i++) {
-            for (unsigned int j=0; j < names.size(); j++) {
-                if (std::count(biparts[i].begin(), biparts[i].end(), name_index[names[j]]) != 0) {
-                    logical_matrix[i][j] = 1;
-                }
-            }
-            //std::cout << get_string_vector(logical_matrix[i]) << std::endl;
-        }
         
         double smallest_proportion = 0.0;
         double TSCA = 0;
         //get the conflicting bipartitions
-        //initialize results vectors
-        for (unsigned int i = 0; i < biparts.size(); i++) {
+        for (int i = 0; i < numbiparts; i++) {
             if (firsttree == true) {
-                if (matrix[0][i] != 1) {
+                if (!std::binary_search(first_biparts.begin(), first_biparts.end(), i)) {
                     continue;
                 }
             }
-            unsigned int sumc = sum_matrix_col(matrix, i);
-            if (sumc != trees.size() && sumc > (smallest_proportion*trees.size())) {
-                std::vector<std::string> nms;
-                for (unsigned int k=0; k < biparts[i].size(); k++) {
-                    nms.push_back(name_st_index[biparts[i][k]]);
-                }
-                (*poos) << "CLADE: " << get_string_vector(nms);
-                if (edgewisealltaxa == true) {
-                    std::vector<std::string> nms_o;
-                    for (unsigned int k=0; k < biparts2[i].size(); k++) {
-                        nms_o.push_back(name_st_index[biparts2[i][k]]);
-                    }
-                    (*poos) << "| " << get_string_vector(nms_o);
-                }
-                double totalcount = bp_count[i];
+            int sumc = bptable.get_tree_count(i);
+            bool conflicted = (sumc != numtrees && sumc > (smallest_proportion*numtrees));
+            if (conflicted == false && sumc != numtrees) {
+                continue;
+            }
+            std::vector<std::string> nms = bptable.get_names(bptable.get_bipart(i));
+            (*poos) << "CLADE: " << get_string_vector(nms);
+            if (edgewisealltaxa == true) {
+                std::vector<std::string> nms_o = bptable.get_names(bptable.get_bipart2(i));
+                (*poos) << "| " << get_string_vector(nms_o);
+            }
+            if (conflicted) {
+                double totalcount = bptable.get_count(i);
                 std::vector<double> conflict_nums;
-                conflict_nums.push_back(bp_count[i]);
+                conflict_nums.push_back(bptable.get_count(i));
                 if (verbose) {
                     (*poos) << "\n\tCONFLICTS:" << std::endl;
                 }
-                for (unsigned int j=0; j < biparts.size(); j++) {
-                    unsigned int sumc2 = sum_matrix_col(matrix, j);
-                    if (i != j && sumc2 != trees.size() && sumc2 > (smallest_proportion*trees.size())) {
-                        bool logitest = test_logical(logical_matrix[i], logical_matrix[j], edgewisealltaxa);
-                        if (logitest) {
-                            std::vector<std::string> nms2;
-                            for (unsigned int k=0; k < biparts[j].size(); k++) {
-                                nms2.push_back(name_st_index[biparts[j][k]]);
-                            }    
-                            totalcount += bp_count[j];
-                            conflict_nums.push_back(bp_count[j]);
+                for (int j=0; j < numbiparts; j++) {
+                    int sumc2 = bptable.get_tree_count(j);
+                    if (i != j && sumc2 != numtrees && sumc2 > (smallest_proportion*numtrees)) {
+                        if (bptable.conflicts(i, j)) {
+                            totalcount += bptable.get_count(j);
+                            conflict_nums.push_back(bptable.get_count(j));
                             if (verbose) {
+                                std::vector<std::string> nms2 = bptable.get_names(bptable.get_bipart(j));
                                 (*poos) << " \t " << get_string_vector(nms2);
                                 if (edgewisealltaxa == true) {
-                                    std::vector<std::string> nms_o;
-                                    for (unsigned int k=0; k < biparts2[j].size(); k++) {
-                                        nms_o.push_back(name_st_index[biparts2[j][k]]);
-                                    }
+                                    std::vector<std::string> nms_o = bptable.get_names(bptable.get_bipart2(j));
                                     (*poos) << "| " << get_string_vector(nms_o);
                                 }
-                                (*poos) << "\tCOUNT:\t" << bp_count[j] << "\tTREEFREQ:\t" << bp_count[j]/trees.size() <<  std::endl;
+                                (*poos) << "\tCOUNT:\t" << bptable.get_count(j) << "\tTREEFREQ:\t"
+                                    << bptable.get_count(j)/numtrees <<  std::endl;
                             }
                         }
                     }
@@ -571,40 +340,18 @@ int main(int argc, char * argv[]) {
                 }
                 TSCA += ICA;
                 ICA *= sign;
-                (*poos) << "\tFREQ:\t" << conflict_nums[0] << "\tICA:\t" << ICA << "\tCOUNT:\t" << bp_count[i] << "\tTREEFREQ:\t" << bp_count[i]/trees.size() <<  std::endl;
-                if (verbose) {
-                    (*poos) << "\tTREES:\t";
-                    for (unsigned int j=0;j<matrix.size();j++) {
-                        if (matrix[j][i] == 1) {
-                            (*poos) << j << " ";   
-                        }
-                    }
-                    (*poos) << std::endl;
-                }
-            } else if (sumc == trees.size()) {
-                std::vector<std::string> nms;
-                for (unsigned int k=0; k < biparts[i].size(); k++) {
-                    nms.push_back(name_st_index[biparts[i][k]]);
-                }
-                (*poos) << "CLADE: " <<  get_string_vector(nms);
-                if (edgewisealltaxa == true) {
-                    std::vector<std::string> nms_o;
-                    for (unsigned int k=0; k < biparts2[i].size(); k++) {
-                        nms_o.push_back(name_st_index[biparts2[i][k]]);
-                    }
-                    (*poos) << "| " << get_string_vector(nms_o);
-                }
-                (*poos) << "\tFREQ:\t1.\tICA:\t1.\tCOUNT:\t" << bp_count[i] << "\tTREEFREQ:\t1." << std::endl;
+                (*poos) << "\tFREQ:\t" << conflict_nums[0] << "\tICA:\t" << ICA << "\tCOUNT:\t"
+                    << bptable.get_count(i) << "\tTREEFREQ:\t" << bptable.get_count(i)/numtrees <<  std::endl;
+            } else {
+                (*poos) << "\tFREQ:\t1.\tICA:\t1.\tCOUNT:\t" << bptable.get_count(i) << "\tTREEFREQ:\t1." << std::endl;
                 TSCA += 1;
-                if (verbose) {
-                    (*poos) << "\tTREES:\t";
-                    for (unsigned int j=0;j<matrix.size();j++) {
-                        if (matrix[j][i] == 1) {
-                            (*poos) << j << " ";   
-                        }
-                    }
-                    (*poos) << std::endl;
+            }
+            if (verbose) {
+                (*poos) << "\tTREES:\t";
+                for (unsigned int j=0; j < bipart_trees[i].size(); j++) {
+                    (*poos) << bipart_trees[i][j] << " ";
                 }
+                (*poos) << std::endl;
             }
         }
         (*poos) << "TSCA: " << TSCA << std::endl;
@@ -618,30 +365,11 @@ int main(int argc, char * argv[]) {
             if (maptree->getInternalNode(i) == maptree->getRoot()) {
                 continue;
             }
-            std::vector<std::string> nms = maptree->getInternalNode(i)->get_leave_names();
-            std::vector<int> nms_i;
-            for (unsigned int k=0; k < nms.size(); k++) {
-                nms_i.push_back(name_index[nms[k]]);
-            }
-            sort(nms_i.begin(), nms_i.end());
-            size_t index;
-            bool found = false;
-            if (edgewisealltaxa == true) {
-                if ((int)std::count(biparts.begin(), biparts.end(), nms_i) == 1) {
-                    index = find(biparts.begin(), biparts.end(), nms_i)-biparts.begin();
-                    found = true;
-                } else {
-                    index = find(biparts2.begin(), biparts2.end(), nms_i)-biparts2.begin();
-                    found = true;
-                } 
-            } else {
-                index = find(biparts.begin(), biparts.end(), nms_i) - biparts.begin();
-                found = true;
-            }
-            if (found == false) {
+            int index = bptable.find_clade(maptree->getInternalNode(i));
+            if (index < 0) {
                 maptree->getInternalNode(i)->setName("0.0");
             } else {
-                maptree->getInternalNode(i)->setName(std::to_string(bp_count[index]/trees.size()));
+                maptree->getInternalNode(i)->setName(std::to_string(bptable.get_count(index)/numtrees));
             }
         }
         (*mpoos) << maptree->getRoot()->getNewick(true) << ";" << std::endl;
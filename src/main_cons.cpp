@@ -0,0 +1,186 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <getopt.h>
+#include <algorithm>
+
+#include "tree.h"
+#include "tree_reader.h"
+#include "bipartition.h"
+#include "consensus.h"
+#include "utils.h"
+#include "log.h"
+#include "constants.h"
+
+extern std::string PHYX_CITATION;
+
+
+void print_help() {
+    std::cout << "Build a consensus tree from a set of trees." << std::endl;
+    std::cout << "Internal nodes are labelled with the proportion of trees that have the" << std::endl;
+    std::cout << "clade, and edges get the mean length over the trees that have them." << std::endl;
+    std::cout << "Trees are assumed rooted unless the -e argument is provided." << std::endl;
+    std::cout << "This will take a newick- or nexus-formatted tree from a file or STDIN." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Usage: pxcons [OPTIONS]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -t, --treef=FILE    input treefile, STDIN otherwise" << std::endl;
+    std::cout << " -m, --method=STR    consensus method: majority (default), strict," << std::endl;
+    std::cout << "                           or greedy (extended majority)" << std::endl;
+    std::cout << " -e, --edgeall       force edgewise (not node - so when things are unrooted) and" << std::endl;
+    std::cout << "                           assume all taxa are present in all trees" << std::endl;
+    std::cout << " -c, --cutoff        skip biparts that have support lower than this." << std::endl;
+    std::cout << " -n, --nthreads=INT  number of threads (open mp), default=1" << std::endl;
+    std::cout << " -o, --outf=FILE     output file, STOUT otherwise" << std::endl;
+    std::cout << " -h, --help          display this help and exit" << std::endl;
+    std::cout << " -V, --version       display version and exit" << std::endl;
+    std::cout << " -C, --citation      display phyx citation and exit" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Report bugs to: <https://github.com/FePhyFoFum/phyx/issues>" << std::endl;
+    std::cout << "phyx home page: <https://github.com/FePhyFoFum/phyx>" << std::endl;
+}
+
+std::string versionline("pxcons 1.1\nCopyright (C) 2026 FePhyFoFum\nLicense GPLv3\nWritten by Stephen A. Smith (blackrim)");
+
+static struct option const long_options[] =
+{
+    {"treef", required_argument, NULL, 't'},
+    {"method", required_argument, NULL, 'm'},
+    {"edgeall", no_argument, NULL, 'e'},
+    {"cutoff", required_argument, NULL, 'c'},
+    {"nthreads", required_argument, NULL, 'n'},
+    {"outf", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {"version", no_argument, NULL, 'V'},
+    {"citation", no_argument, NULL, 'C'},
+    {NULL, 0, NULL, 0}
+};
+
+int main(int argc, char * argv[]) {
+
+    log_call(argc, argv);
+
+    bool fileset = false;
+    bool outfileset = false;
+    bool edgewisealltaxa = false;
+    bool cutoff = false;
+    char * treef = NULL;
+    char * outf = NULL;
+    double cutnum = 0;
+    int num_threads = 1;
+    std::string method = "majority";
+    while (1) {
+        int oi = -1;
+        int c = getopt_long(argc, argv, "t:m:c:n:o:ehVC", long_options, &oi);
+        if (c == -1) {
+            break;
+        }
+        switch(c) {
+            case 't':
+                fileset = true;
+                treef = strdup(optarg);
+                check_file_exists(treef);
+                break;
+            case 'm':
+                method = string_to_lower(optarg);
+                break;
+            case 'e':
+                edgewisealltaxa = true;
+                break;
+            case 'c':
+                cutnum = string_to_float(optarg, "-c");
+                cutoff = true;
+                break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
+            case 'o':
+                outfileset = true;
+                outf = strdup(optarg);
+                break;
+            case 'h':
+                print_help();
+                exit(0);
+            case 'V':
+                std::cout << versionline << std::endl;
+                exit(0);
+            case 'C':
+                std::cout << PHYX_CITATION << std::endl;
+                exit(0);
+            default:
+                print_error(argv[0], (char)c);
+                exit(0);
+        }
+    }
+
+    if (ConsensusBuilder::is_method(method) == false) {
+        std::cerr << "Error: consensus method '" << method
+            << "' not recognized (strict, majority, or greedy). Exiting." << std::endl;
+        exit(0);
+    }
+
+    if (fileset && outfileset) {
+        check_inout_streams_identical(treef, outf);
+    }
+
+    std::istream * pios = NULL;
+    std::ostream * poos = NULL;
+    std::ifstream * fstr = NULL;
+    std::ofstream * ofstr = NULL;
+
+    if (fileset == true) {
+        fstr = new std::ifstream(treef);
+        pios = fstr;
+    } else {
+        pios = &std::cin;
+        if (check_for_input_to_stream() == false) {
+            print_help();
+            exit(1);
+        }
+    }
+    if (outfileset == true) {
+        ofstr = new std::ofstream(outf);
+        poos = ofstr;
+    } else {
+        poos = &std::cout;
+    }
+
+    // trees are read in blocks, tallied, and freed
+    BipartitionTable bptable(edgewisealltaxa);
+    if (cutoff == true) {
+        bptable.set_cutoff(cutnum);
+    }
+    TreeBlockReader reader(*pios, num_threads);
+    std::vector<Tree *> trees;
+    while (reader.next_block(trees)) {
+        bptable.add_trees(trees, num_threads);
+        for (unsigned int i=0; i < trees.size(); i++) {
+            delete trees[i];
+        }
+        trees.clear();
+    }
+
+    if (bptable.get_num_trees() == 0) {
+        std::cerr << "Error: there are no trees. Exiting." << std::endl;
+        exit(0);
+    }
+
+    ConsensusBuilder cb(bptable, method);
+    Tree * constree = cb.get_tree();
+    (*poos) << constree->getRoot()->getNewick(constree->hasEdgeLengths()) << ";" << std::endl;
+    delete constree;
+
+    if (fileset) {
+        fstr->close();
+        delete pios;
+    }
+    if (outfileset) {
+        ofstr->close();
+        delete poos;
+    }
+    return EXIT_SUCCESS;
+}
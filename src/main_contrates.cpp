@@ -6,6 +6,10 @@
 #include <cstring>
 #include <getopt.h>
 
+#ifdef OMP
+#include <omp.h>
+#endif
+
 #include "string_node_object.h"
 #include "utils.h"
 #include "sequence.h"
@@ -29,7 +33,12 @@ void print_help() {
     std::cout << "Options:" << std::endl;
     std::cout << " -c, --charf=FILE     input character file, STDIN otherwise" << std::endl;
     std::cout << " -t, --treef=FILE     input tree file, STDIN otherwise" << std::endl;
-    std::cout << " -a, --analysis=NUM   analysis type (0=anc[DEFAULT], 1=ratetest)" << std::endl;
+    std::cout << " -a, --analysis=NUM   analysis type (0=anc[DEFAULT], 1=ratetest," << std::endl;
+    std::cout << "                           2=ratetest of all characters on all trees," << std::endl;
+    std::cout << "                           3=vcv of each tree, no character file needed)" << std::endl;
+    std::cout << " -m, --vcvform=STR    layout of the -a 3 vcv: full[DEFAULT], upper, or" << std::endl;
+    std::cout << "                           packed (upper triangle by columns, on one line)" << std::endl;
+    std::cout << " -n, --nthreads=INT   number of threads (open mp) for -a 2, default=1" << std::endl;
     std::cout << " -o, --outf=FILE      output sequence file, STOUT otherwise" << std::endl;
     std::cout << " -h, --help           display this help and exit" << std::endl;
     std::cout << " -V, --version        display version and exit" << std::endl;
@@ -47,12 +56,118 @@ static struct option const long_options[] =
     {"tree", required_argument, NULL, 't'},
     {"outf", required_argument, NULL, 'o'},
     {"analysis", required_argument, NULL, 'a'},
+    {"vcvform", required_argument, NULL, 'm'},
+    {"nthreads", required_argument, NULL, 'n'},
     {"help", no_argument, NULL, 'h'},
     {"version", no_argument, NULL, 'V'},
     {"citation", no_argument, NULL, 'C'},
     {NULL, 0, NULL, 0}
 };
 
+/*
+ * fit bm and ou to every character on every tree. the pruning setup is done
+ * once per tree and shared by its characters; the (tree, character) jobs are
+ * spread over the threads and written as one table in tree, character order
+ */
+void batch_ratetest (std::vector<Tree *>& trees, std::vector<Sequence>& seqs,
+        std::map<std::string, int>& seq_map, const int& num_chars,
+        const int& num_threads, std::ostream * poouts) {
+    int num_trees = (int)trees.size();
+    std::vector<ContPruner> pruners;
+    std::vector<std::vector<std::vector<double> > > vals(num_trees);
+    for (int t=0; t < num_trees; t++) {
+        pruners.push_back(ContPruner(trees[t]));
+        int n = trees[t]->getExternalNodeCount();
+        vals[t].assign(num_chars, std::vector<double>(n));
+        for (int i=0; i < n; i++) {
+            std::string name = trees[t]->getExternalNode(i)->getName();
+            if (seq_map.count(name) == 0) {
+                std::cerr << "Error: taxon '" << name << "' in tree " << t
+                    << " is not in the character file. Exiting." << std::endl;
+                exit(0);
+            }
+            for (int c=0; c < num_chars; c++) {
+                vals[t][c][i] = seqs[seq_map[name]].get_cont_char(c);
+            }
+        }
+    }
+    int num_jobs = num_trees * num_chars;
+    std::vector<std::vector<double> > bm_res(num_jobs);
+    std::vector<std::vector<double> > ou_res(num_jobs);
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    #pragma omp parallel for schedule(dynamic)
+    for (int j=0; j < num_jobs; j++) {
+        int t = j / num_chars;
+        int c = j % num_chars;
+        bm_res[j] = optimize_single_rate_bm_nlopt(vals[t][c], pruners[t], true);
+        ou_res[j] = optimize_single_rate_bm_ou_nlopt(vals[t][c], pruners[t]);
+    }
+    (*poouts) << "tree\tchar\tmodel\tstate\trate\talpha\tlnL\tAIC\tAICc" << std::endl;
+    for (int j=0; j < num_jobs; j++) {
+        int t = j / num_chars;
+        int c = j % num_chars;
+        double n = trees[t]->getExternalNodeCount();
+        double like = -bm_res[j][2];
+        double aic = (2*2)-(2*like);
+        double aicc = aic + ((2*2*(2+1))/(n-2-1));
+        (*poouts) << t << "\t" << c << "\tBM\t" << bm_res[j][0] << "\t" << bm_res[j][1]
+            << "\tNA\t" << like << "\t" << aic << "\t" << aicc << std::endl;
+        like = -ou_res[j][3];
+        aic = (2*3)-(2*like);
+        aicc = aic + ((2*3*(3+1))/(n-3-1));
+        (*poouts) << t << "\t" << c << "\tOU\t" << ou_res[j][0] << "\t" << ou_res[j][1]
+            << "\t" << ou_res[j][2] << "\t" << like << "\t" << aic << "\t" << aicc << std::endl;
+    }
+}
+
+
+/*
+ * the phylogenetic vcv of a tree (the shared path length from the root of
+ * each pair of tips), with the tips in tree order. full and upper have a
+ * header of tip names and a row per tip; upper leaves the cells below the
+ * diagonal empty. packed is the header and then one line with the upper
+ * triangle by columns (lapack 'U' packed storage)
+ */
+void write_vcv (Tree * tree, const std::string& form, std::ostream * poouts) {
+    int n = tree->getExternalNodeCount();
+    if (form == "packed") {
+        vec vcv;
+        calc_vcv_packed(tree, vcv);
+        for (int i=0; i < n; i++) {
+            (*poouts) << ((i == 0) ? "" : "\t") << tree->getExternalNode(i)->getName();
+        }
+        (*poouts) << std::endl;
+        for (uword i=0; i < vcv.n_elem; i++) {
+            (*poouts) << ((i == 0) ? "" : "\t") << vcv(i);
+        }
+        (*poouts) << std::endl;
+        return;
+    }
+    mat vcv;
+    if (form == "upper") {
+        calc_vcv_upper(tree, vcv);
+    } else {
+        calc_vcv(tree, vcv);
+    }
+    for (int i=0; i < n; i++) {
+        (*poouts) << "\t" << tree->getExternalNode(i)->getName();
+    }
+    (*poouts) << std::endl;
+    for (int i=0; i < n; i++) {
+        (*poouts) << tree->getExternalNode(i)->getName();
+        for (int j=0; j < n; j++) {
+            (*poouts) << "\t";
+            if (form == "full" || j >= i) {
+                (*poouts) << vcv(i, j);
+            }
+        }
+        (*poouts) << std::endl;
+    }
+}
+
+
 int main(int argc, char * argv[]) {
     
     log_call(argc, argv);
@@ -65,9 +180,11 @@ int main(int argc, char * argv[]) {
     char * charf = NULL;
     char * outf = NULL;
     int analysis = 0;
+    int num_threads = 1;
+    std::string vcvform = "full";
     while (1) {
         int oi = -1;
-        int c = getopt_long(argc, argv, "c:t:o:a:hVC", long_options, &oi);
+        int c = getopt_long(argc, argv, "c:t:o:a:m:n:hVC", long_options, &oi);
         if (c == -1) {
             break;
         }
@@ -89,8 +206,22 @@ int main(int argc, char * argv[]) {
             case 'a':
                 if (optarg[0] == '1') {
                     analysis = 1;
+                } else if (optarg[0] == '2') {
+                    analysis = 2;
+                } else if (optarg[0] == '3') {
+                    analysis = 3;
+                }
+                break;
+            case 'm':
+                vcvform = optarg;
+                if (vcvform != "full" && vcvform != "upper" && vcvform != "packed") {
+                    std::cerr << "Error: -m must be full, upper, or packed. Exiting." << std::endl;
+                    exit(0);
                 }
                 break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
             case 'h':
                 print_help();
                 exit(0);
@@ -124,7 +255,7 @@ int main(int argc, char * argv[]) {
     if (cfileset == true) {
         cfstr = new std::ifstream(charf);
         pios = cfstr;
-    } else {
+    } else if (analysis != 3) {
         std::cerr << "Error: you have to set a character file. Only a tree file can be read in through the stream. Exiting." << std::endl;
         exit(1);
     }
@@ -138,29 +269,32 @@ int main(int argc, char * argv[]) {
     }
 
     std::string retstring;
-    int ft = test_char_filetype_stream(*pios, retstring);
-    if (ft != 1 && ft != 2) {
-        std::cerr << "Error: only fasta and phylip (with spaces) supported so far. Exiting." << std::endl;
-        exit(0);
-    }
     Sequence seq;
     std::vector<Sequence> seqs;
     std::map<std::string, int> seq_map;
-    int y = 0;
-    int num_chars = 0 ;
-    while (read_next_seq_char_from_stream(*pios, ft, retstring, seq)) {
-        seqs.push_back(seq);
-        num_chars = seq.get_num_cont_char();
-        seq_map[seq.get_id()] = y;
-        seq.clear_cont_char();
-        y++;
-    }
-    
-    if (ft == 2) {
-        seqs.push_back(seq);
-        seq_map[seq.get_id()] = y;
-        seq.clear_cont_char();
+    int num_chars = 0;
+    if (cfileset == true) {
+        int ft = test_char_filetype_stream(*pios, retstring);
+        if (ft != 1 && ft != 2) {
+            std::cerr << "Error: only fasta and phylip (with spaces) supported so far. Exiting." << std::endl;
+            exit(0);
+        }
+        int y = 0;
+        while (read_next_seq_char_from_stream(*pios, ft, retstring, seq)) {
+            seqs.push_back(seq);
+            num_chars = seq.get_num_cont_char();
+            seq_map[seq.get_id()] = y;
+            seq.clear_cont_char();
+            y++;
+        }
+
+        if (ft == 2) {
+            seqs.push_back(seq);
+            seq_map[seq.get_id()] = y;
+            seq.clear_cont_char();
+        }
     }
+
     //read trees
     TreeReader tr;
     std::vector<Tree *> trees;
@@ -168,8 +302,19 @@ int main(int argc, char * argv[]) {
         trees.push_back(tr.readTree(retstring));
     }
     
+    if (analysis == 2) {
+        batch_ratetest(trees, seqs, seq_map, num_chars, num_threads, poouts);
+    } else if (analysis == 3) {
+        for (unsigned int x = 0; x < trees.size(); x++) {
+            if (x > 0) {
+                (*poouts) << std::endl;
+            }
+            write_vcv(trees[x], vcvform, poouts);
+        }
+    }
+    
     //conduct analyses for each character
-    for (int c=0; c < num_chars; c++) {
+    for (int c=0; c < num_chars && analysis < 2; c++) {
         std::cerr << "character: " << c << std::endl;
         if (analysis == 0) {
            // std::cout << "Input tree: " << getNewickString(trees[0]) << ";" << std::endl;
@@ -219,22 +364,21 @@ int main(int argc, char * argv[]) {
             remove_annotations(trees[0]);
             
         } else if (analysis == 1) {
-            mat vcv;
             int t_ind = 0; // TODO: do this over trees
             int c_ind = c;
-            calc_vcv(trees[t_ind], vcv);
+            ContPruner pruner(trees[t_ind]);
             int n = trees[t_ind]->getExternalNodeCount();
-            rowvec x = rowvec(n);
+            std::vector<double> x(n);
             for (int i=0; i < n; i++) {
-                x(i) = seqs[seq_map[trees[t_ind]->getExternalNode(i)->getName()]].get_cont_char(c_ind);
+                x[i] = seqs[seq_map[trees[t_ind]->getExternalNode(i)->getName()]].get_cont_char(c_ind);
             }
-            std::vector<double> res = optimize_single_rate_bm_nlopt(x, vcv, true);
+            std::vector<double> res = optimize_single_rate_bm_nlopt(x, pruner, true);
             double aic = (2*2)-(2*(-res[2]));
             double aicc = aic + ((2*2*(2+1))/(n-2-1));
             std::cout << c << " BM " << " state: " << res[0] <<  " rate: " << res[1]
                 << " like: " << -res[2] << " aic: " << aic << " aicc: " << aicc <<  std::endl;
 
-            std::vector<double> res2 = optimize_single_rate_bm_ou_nlopt(x, vcv);
+            std::vector<double> res2 = optimize_single_rate_bm_ou_nlopt(x, pruner);
             aic = (2*3)-(2*(-res2[3]));
             aicc = aic + ((2*3*(3+1))/(n-3-1));
             std::cout << c << " OU " << " state: " << res2[0] <<  " rate: "
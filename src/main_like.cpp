@@ -0,0 +1,279 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <iomanip>
+#include <getopt.h>
+
+#ifdef OMP
+#include <omp.h>
+#endif
+
+#include "utils.h"
+#include "sequence.h"
+#include "seq_reader.h"
+#include "tree_reader.h"
+#include "tree.h"
+#include "seq_likelihood.h"
+#include "log.h"
+
+extern std::string PHYX_CITATION;
+
+
+void print_help() {
+    std::cout << "Log-likelihood of an alignment on one or more trees." << std::endl;
+    std::cout << "GTR (DNA) or user-specified (AA) model with discrete-gamma rate variation." << std::endl;
+    std::cout << "This will take fasta, phylip, and nexus alignments; trees from a file or STDIN." << std::endl;
+    std::cout << "Trees need branch lengths, one (newick) tree per line." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Usage: pxlike [OPTIONS]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -s, --seqf=FILE        input sequence file" << std::endl;
+    std::cout << " -t, --treef=FILE       input tree file, STDIN otherwise" << std::endl;
+    std::cout << " -b, --basef=Input      comma-delimited base freqs in order: A,C,G,T. default is equal" << std::endl;
+    std::cout << " -r, --ratemat=Input    comma-delimited input values for rate matrix. default is JC69" << std::endl;
+    std::cout << "                          order: A<->C,A<->G,A<->T,C<->G,C<->T,G<->T" << std::endl;
+    std::cout << " -q, --aabasefreq=Input AA frequencies, order: ARNDCQEGHILKMFPSTWYV. default is equal" << std::endl;
+    std::cout << " -w, --aaratemat=Input  comma-delimited amino acid rate matrix (190 values). default is equal" << std::endl;
+    std::cout << "                          order: upper triangle by rows of ARNDCQEGHILKMFPSTWYV" << std::endl;
+    std::cout << " -g, --gamma=FLOAT      gamma shape value. default is no rate variation" << std::endl;
+    std::cout << " -k, --ncat=INT         number of gamma rate categories, default=4" << std::endl;
+#ifdef OMP
+    std::cout << " -n, --nthreads=INT     number of threads (open mp), default=1" << std::endl;
+#endif
+    std::cout << " -o, --outf=FILE        output file, STOUT otherwise" << std::endl;
+    std::cout << " -h, --help             display this help and exit" << std::endl;
+    std::cout << " -V, --version          display version and exit" << std::endl;
+    std::cout << " -C, --citation         display phyx citation and exit" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Report bugs to: <https://github.com/FePhyFoFum/phyx/issues>" << std::endl;
+    std::cout << "phyx home page: <https://github.com/FePhyFoFum/phyx>" << std::endl;
+}
+
+std::string versionline("pxlike 1.1\nCopyright (C) 2026 FePhyFoFum\nLicense GPLv3\nWritten by Stephen A. Smith (blackrim)");
+
+static struct option const long_options[] =
+{
+    {"seqf", required_argument, NULL, 's'},
+    {"treef", required_argument, NULL, 't'},
+    {"basef", required_argument, NULL, 'b'},
+    {"ratemat", required_argument, NULL, 'r'},
+    {"aabasefreq", required_argument, NULL, 'q'},
+    {"aaratemat", required_argument, NULL, 'w'},
+    {"gamma", required_argument, NULL, 'g'},
+    {"ncat", required_argument, NULL, 'k'},
+    {"nthreads", required_argument, NULL, 'n'},
+    {"outf", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {"version", no_argument, NULL, 'V'},
+    {"citation", no_argument, NULL, 'C'},
+    {NULL, 0, NULL, 0}
+};
+
+int main(int argc, char * argv[]) {
+
+    log_call(argc, argv);
+
+    bool sfileset = false;
+    bool tfileset = false;
+    bool outfileset = false;
+    char * seqf = NULL;
+    char * treef = NULL;
+    char * outf = NULL;
+    std::string inlist;
+    std::vector<double> basefreq(4, 0.25);
+    std::vector<double> rates(6, 1.0);
+    std::vector<double> aabasefreq(20, 0.05);
+    std::vector<double> aarates(190, 1.0);
+    double alpha = -1.0;
+    int ncat = 4;
+    int num_threads = 1;
+
+    while (1) {
+        int oi = -1;
+        int c = getopt_long(argc, argv, "s:t:b:r:q:w:g:k:n:o:hVC", long_options, &oi);
+        if (c == -1) {
+            break;
+        }
+        switch(c) {
+            case 's':
+                sfileset = true;
+                seqf = strdup(optarg);
+                check_file_exists(seqf);
+                break;
+            case 't':
+                tfileset = true;
+                treef = strdup(optarg);
+                check_file_exists(treef);
+                break;
+            case 'b':
+                inlist = strdup(optarg);
+                parse_comma_list(inlist, basefreq);
+                if (basefreq.size() != 4) {
+                    std::cerr << "Error: must provide 4 base frequencies (" << basefreq.size()
+                        << " provided). Exiting." << std::endl;
+                    exit(0);
+                }
+                if (!essentially_equal(sum(basefreq), 1.0)) {
+                    std::cerr << "Error: base frequencies must sum to 1.0. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
+            case 'r':
+                inlist = strdup(optarg);
+                parse_comma_list(inlist, rates);
+                if (rates.size() != 6) {
+                    std::cerr << "Error: must provide 6 substitution parameters. " <<
+                        "Only " << rates.size() << " provided. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
+            case 'q':
+                inlist = strdup(optarg);
+                parse_comma_list(inlist, aabasefreq);
+                if (aabasefreq.size() != 20) {
+                    std::cerr << "Error: must provide 20 base frequencies (" << aabasefreq.size()
+                        << " provided). Exiting." << std::endl;
+                    exit(0);
+                }
+                if (!essentially_equal(sum(aabasefreq), 1.0)) {
+                    std::cerr << "Error: base frequencies must sum to 1.0. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
+            case 'w':
+                inlist = strdup(optarg);
+                parse_comma_list(inlist, aarates);
+                if (aarates.size() != 190) {
+                    std::cerr << "Error: must provide 190 substitution parameters. " <<
+                        "Only " << aarates.size() << " provided. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
+            case 'g':
+                alpha = string_to_float(optarg, "-g");
+                break;
+            case 'k':
+                ncat = string_to_int(optarg, "-k");
+                break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
+            case 'o':
+                outfileset = true;
+                outf = strdup(optarg);
+                break;
+            case 'h':
+                print_help();
+                exit(0);
+            case 'V':
+                std::cout << versionline << std::endl;
+                exit(0);
+            case 'C':
+                std::cout << PHYX_CITATION << std::endl;
+                exit(0);
+            default:
+                print_error(argv[0], (char)c);
+                exit(0);
+        }
+    }
+
+    if (tfileset && outfileset) {
+        check_inout_streams_identical(treef, outf);
+    }
+    if (sfileset && outfileset) {
+        check_inout_streams_identical(seqf, outf);
+    }
+
+    std::istream * pios = NULL;
+    std::istream * poos = NULL;
+    std::ifstream * sfstr = NULL;
+    std::ifstream * tfstr = NULL;
+    std::ostream * poouts = NULL;
+    std::ofstream * ofstr = NULL;
+
+    if (sfileset == true) {
+        sfstr = new std::ifstream(seqf);
+        pios = sfstr;
+    } else {
+        std::cerr << "Error: you have to set a sequence file. Only a tree file can be read in through the stream. Exiting." << std::endl;
+        exit(0);
+    }
+    if (tfileset == true) {
+        tfstr = new std::ifstream(treef);
+        poos = tfstr;
+    } else {
+        poos = &std::cin;
+        if (check_for_input_to_stream() == false) {
+            print_help();
+            exit(1);
+        }
+    }
+    if (outfileset == true) {
+        ofstr = new std::ofstream(outf);
+        poouts = ofstr;
+    } else {
+        poouts = &std::cout;
+    }
+
+    std::string alphaName = "";
+    std::vector<Sequence> seqs = ingest_alignment(pios, alphaName);
+    bool is_dna = true;
+    if (alphaName == "AA") {
+        is_dna = false;
+    } else if (alphaName != "DNA") {
+        std::cerr << "Error: only DNA and amino acid alignments are supported. Exiting." << std::endl;
+        exit(0);
+    }
+    SeqLikelihood sl(seqs, is_dna, is_dna ? basefreq : aabasefreq,
+        is_dna ? rates : aarates, alpha, ncat);
+
+    TreeReader tr;
+    std::vector<Tree *> trees;
+    std::string retstring;
+    while (getline(*poos, retstring)) {
+        if (retstring.size() < 2) {
+            continue;
+        }
+        Tree * tree = tr.readTree(retstring);
+        if (!tree->hasEdgeLengths()) {
+            std::cerr << "Error: tree " << trees.size()
+                << " has no branch lengths. Exiting." << std::endl;
+            exit(0);
+        }
+        trees.push_back(tree);
+    }
+
+    // trees are independent, so they are simply shared out among the threads
+    int num_trees = (int)trees.size();
+    std::vector<double> lnls(num_trees, 0.0);
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    #pragma omp parallel for schedule(dynamic)
+    for (int i=0; i < num_trees; i++) {
+        lnls[i] = sl.calc_log_likelihood(trees[i]);
+    }
+    (*poouts) << std::fixed << std::setprecision(6);
+    for (int i=0; i < num_trees; i++) {
+        (*poouts) << lnls[i] << std::endl;
+        delete trees[i];
+    }
+
+    if (sfileset) {
+        sfstr->close();
+        delete pios;
+    }
+    if (tfileset) {
+        tfstr->close();
+        delete poos;
+    }
+    if (outfileset) {
+        ofstr->close();
+        delete poouts;
+    }
+
+    return EXIT_SUCCESS;
+}
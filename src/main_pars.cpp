@@ -0,0 +1,199 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <getopt.h>
+
+#ifdef OMP
+#include <omp.h>
+#endif
+
+#include "utils.h"
+#include "sequence.h"
+#include "seq_reader.h"
+#include "tree_reader.h"
+#include "tree.h"
+#include "parsimony.h"
+#include "log.h"
+#include "constants.h"
+
+extern std::string PHYX_CITATION;
+
+
+void print_help() {
+    std::cout << "Fitch parsimony score of an alignment on one or more trees." << std::endl;
+    std::cout << "This will take fasta, phylip, and nexus alignments; trees from a file or STDIN." << std::endl;
+    std::cout << "Trees need all of the taxa in the alignment, one (newick) tree per line." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Usage: pxpars [OPTIONS]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -s, --seqf=FILE     input sequence file" << std::endl;
+    std::cout << " -t, --treef=FILE    input tree file, STDIN otherwise" << std::endl;
+#ifdef OMP
+    std::cout << " -n, --nthreads=INT  number of threads (open mp), default=1" << std::endl;
+#endif
+    std::cout << " -o, --outf=FILE     output file, STOUT otherwise" << std::endl;
+    std::cout << " -h, --help          display this help and exit" << std::endl;
+    std::cout << " -V, --version       display version and exit" << std::endl;
+    std::cout << " -C, --citation      display phyx citation and exit" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Report bugs to: <https://github.com/FePhyFoFum/phyx/issues>" << std::endl;
+    std::cout << "phyx home page: <https://github.com/FePhyFoFum/phyx>" << std::endl;
+}
+
+std::string versionline("pxpars 1.1\nCopyright (C) 2026 FePhyFoFum\nLicense GPLv3\nWritten by Stephen A. Smith (blackrim)");
+
+static struct option const long_options[] =
+{
+    {"seqf", required_argument, NULL, 's'},
+    {"treef", required_argument, NULL, 't'},
+    {"nthreads", required_argument, NULL, 'n'},
+    {"outf", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {"version", no_argument, NULL, 'V'},
+    {"citation", no_argument, NULL, 'C'},
+    {NULL, 0, NULL, 0}
+};
+
+int main(int argc, char * argv[]) {
+
+    log_call(argc, argv);
+
+    bool sfileset = false;
+    bool tfileset = false;
+    bool outfileset = false;
+    char * seqf = NULL;
+    char * treef = NULL;
+    char * outf = NULL;
+    int num_threads = 1;
+
+    while (1) {
+        int oi = -1;
+        int c = getopt_long(argc, argv, "s:t:n:o:hVC", long_options, &oi);
+        if (c == -1) {
+            break;
+        }
+        switch(c) {
+            case 's':
+                sfileset = true;
+                seqf = strdup(optarg);
+                check_file_exists(seqf);
+                break;
+            case 't':
+                tfileset = true;
+                treef = strdup(optarg);
+                check_file_exists(treef);
+                break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
+            case 'o':
+                outfileset = true;
+                outf = strdup(optarg);
+                break;
+            case 'h':
+                print_help();
+                exit(0);
+            case 'V':
+                std::cout << versionline << std::endl;
+                exit(0);
+            case 'C':
+                std::cout << PHYX_CITATION << std::endl;
+                exit(0);
+            default:
+                print_error(argv[0], (char)c);
+                exit(0);
+        }
+    }
+
+    if (tfileset && outfileset) {
+        check_inout_streams_identical(treef, outf);
+    }
+    if (sfileset && outfileset) {
+        check_inout_streams_identical(seqf, outf);
+    }
+
+    std::istream * pios = NULL;
+    std::istream * poos = NULL;
+    std::ifstream * sfstr = NULL;
+    std::ifstream * tfstr = NULL;
+    std::ostream * poouts = NULL;
+    std::ofstream * ofstr = NULL;
+
+    if (sfileset == true) {
+        sfstr = new std::ifstream(seqf);
+        pios = sfstr;
+    } else {
+        std::cerr << "Error: you have to set a sequence file. Only a tree file can be read in through the stream. Exiting." << std::endl;
+        exit(0);
+    }
+    if (tfileset == true) {
+        tfstr = new std::ifstream(treef);
+        poos = tfstr;
+    } else {
+        poos = &std::cin;
+        if (check_for_input_to_stream() == false) {
+            print_help();
+            exit(1);
+        }
+    }
+    if (outfileset == true) {
+        ofstr = new std::ofstream(outf);
+        poouts = ofstr;
+    } else {
+        poouts = &std::cout;
+    }
+
+    std::string alphaName = "";
+    std::vector<Sequence> seqs = ingest_alignment(pios, alphaName);
+    bool is_dna = true;
+    if (alphaName == "AA") {
+        is_dna = false;
+    } else if (alphaName != "DNA") {
+        std::cerr << "Error: only DNA and amino acid alignments are supported. Exiting." << std::endl;
+        exit(0);
+    }
+    FitchParsimony fp(seqs, is_dna);
+
+    TreeReader tr;
+    std::vector<Tree *> trees;
+    std::string retstring;
+    while (getline(*poos, retstring)) {
+        if (retstring.size() < 2) {
+            continue;
+        }
+        trees.push_back(tr.readTree(retstring));
+    }
+
+    // trees are independent, so they are simply shared out among the threads
+    int num_trees = (int)trees.size();
+    std::vector<int> scores(num_trees, 0);
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    #pragma omp parallel for schedule(dynamic)
+    for (int i=0; i < num_trees; i++) {
+        scores[i] = fp.calc_score(trees[i]);
+    }
+    for (int i=0; i < num_trees; i++) {
+        (*poouts) << scores[i] << std::endl;
+        delete trees[i];
+    }
+
+    if (sfileset) {
+        sfstr->close();
+        delete pios;
+    }
+    if (tfileset) {
+        tfstr->close();
+        delete poos;
+    }
+    if (outfileset) {
+        ofstr->close();
+        delete poouts;
+    }
+
+    return EXIT_SUCCESS;
+}
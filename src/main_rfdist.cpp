@@ -0,0 +1,193 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <getopt.h>
+#include <algorithm>
+
+#include "tree.h"
+#include "tree_reader.h"
+#include "rf_distance.h"
+#include "utils.h"
+#include "log.h"
+#include "constants.h"
+
+extern std::string PHYX_CITATION;
+
+
+void print_help() {
+    std::cout << "Calculate Robinson-Foulds distances between trees." << std::endl;
+    std::cout << "Trees are treated as unrooted. Trees that do not share all of their taxa are" << std::endl;
+    std::cout << "compared on their subtrees induced on the taxa they have in common." << std::endl;
+    std::cout << "Output is a tab-delimited matrix of all of the trees against each other or," << std::endl;
+    std::cout << "if the -r argument is provided, one row for each reference tree." << std::endl;
+    std::cout << "This will take a newick- or nexus-formatted tree from a file or STDIN." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Usage: pxrfdist [OPTIONS]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -t, --treef=FILE    input treefile, STDIN otherwise" << std::endl;
+    std::cout << " -r, --reftree=FILE  reference treefile to compare all of the input trees to" << std::endl;
+    std::cout << " -n, --nthreads=INT  number of threads (open mp), default=1" << std::endl;
+    std::cout << " -o, --outf=FILE     output file, STOUT otherwise" << std::endl;
+    std::cout << " -h, --help          display this help and exit" << std::endl;
+    std::cout << " -V, --version       display version and exit" << std::endl;
+    std::cout << " -C, --citation      display phyx citation and exit" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Report bugs to: <https://github.com/FePhyFoFum/phyx/issues>" << std::endl;
+    std::cout << "phyx home page: <https://github.com/FePhyFoFum/phyx>" << std::endl;
+}
+
+std::string versionline("pxrfdist 1.1\nCopyright (C) 2026 FePhyFoFum\nLicense GPLv3\nWritten by Stephen A. Smith (blackrim)");
+
+static struct option const long_options[] =
+{
+    {"treef", required_argument, NULL, 't'},
+    {"reftree", required_argument, NULL, 'r'},
+    {"nthreads", required_argument, NULL, 'n'},
+    {"outf", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {"version", no_argument, NULL, 'V'},
+    {"citation", no_argument, NULL, 'C'},
+    {NULL, 0, NULL, 0}
+};
+
+
+// read the trees in blocks, keeping only their splits
+void read_trees (std::istream& ios, RFDistance& rf, const int& num_threads) {
+    TreeBlockReader reader(ios, num_threads);
+    std::vector<Tree *> trees;
+    while (reader.next_block(trees)) {
+        rf.add_trees(trees, num_threads);
+        for (unsigned int i=0; i < trees.size(); i++) {
+            delete trees[i];
+        }
+        trees.clear();
+    }
+}
+
+
+int main(int argc, char * argv[]) {
+
+    log_call(argc, argv);
+
+    bool fileset = false;
+    bool reffileset = false;
+    bool outfileset = false;
+    char * treef = NULL;
+    char * reff = NULL;
+    char * outf = NULL;
+    int num_threads = 1;
+    while (1) {
+        int oi = -1;
+        int c = getopt_long(argc, argv, "t:r:n:o:hVC", long_options, &oi);
+        if (c == -1) {
+            break;
+        }
+        switch(c) {
+            case 't':
+                fileset = true;
+                treef = strdup(optarg);
+                check_file_exists(treef);
+                break;
+            case 'r':
+                reffileset = true;
+                reff = strdup(optarg);
+                check_file_exists(reff);
+                break;
+            case 'n':
+                num_threads = string_to_int(optarg, "-n");
+                break;
+            case 'o':
+                outfileset = true;
+                outf = strdup(optarg);
+                break;
+            case 'h':
+                print_help();
+                exit(0);
+            case 'V':
+                std::cout << versionline << std::endl;
+                exit(0);
+            case 'C':
+                std::cout << PHYX_CITATION << std::endl;
+                exit(0);
+            default:
+                print_error(argv[0], (char)c);
+                exit(0);
+        }
+    }
+
+    if (fileset && outfileset) {
+        check_inout_streams_identical(treef, outf);
+    }
+
+    std::istream * pios = NULL;
+    std::ostream * poos = NULL;
+    std::ifstream * fstr = NULL;
+    std::ofstream * ofstr = NULL;
+
+    if (fileset == true) {
+        fstr = new std::ifstream(treef);
+        pios = fstr;
+    } else {
+        pios = &std::cin;
+        if (check_for_input_to_stream() == false) {
+            print_help();
+            exit(1);
+        }
+    }
+    if (outfileset == true) {
+        ofstr = new std::ofstream(outf);
+        poos = ofstr;
+    } else {
+        poos = &std::cout;
+    }
+
+    // reference trees (if any) come first, so they share the split hashing
+    RFDistance rf;
+    int num_ref = 0;
+    if (reffileset) {
+        std::ifstream rstr(reff);
+        read_trees(rstr, rf, num_threads);
+        rstr.close();
+        num_ref = rf.get_num_trees();
+        if (num_ref == 0) {
+            std::cerr << "Error: there are no reference trees. Exiting." << std::endl;
+            exit(0);
+        }
+    }
+    read_trees(*pios, rf, num_threads);
+    int num_trees = rf.get_num_trees();
+    if (num_trees == num_ref) {
+        std::cerr << "Error: there are no trees. Exiting." << std::endl;
+        exit(0);
+    }
+
+    std::vector<std::vector<int> > dists;
+    if (reffileset) {
+        dists = rf.get_matrix(0, num_ref, num_ref, num_trees, num_threads);
+    } else {
+        dists = rf.get_matrix(0, num_trees, 0, num_trees, num_threads);
+    }
+    for (unsigned int i = 0; i < dists.size(); i++) {
+        for (unsigned int j = 0; j < dists[i].size(); j++) {
+            if (j > 0) {
+                (*poos) << "\t";
+            }
+            (*poos) << dists[i][j];
+        }
+        (*poos) << std::endl;
+    }
+
+    if (fileset) {
+        fstr->close();
+        delete pios;
+    }
+    if (outfileset) {
+        ofstr->close();
+        delete poos;
+    }
+    return EXIT_SUCCESS;
+}
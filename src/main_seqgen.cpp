@@ -5,10 +5,15 @@
 #include <cstring>
 #include <getopt.h>
 
+#ifdef OMP
+#include <omp.h>
+#endif
+
 #include "seq_gen.h"
 #include "utils.h"
 #include "tree.h"
 #include "tree_reader.h"
+#include "tree_utils.h"
 #include "log.h"
 
 extern std::string PHYX_CITATION;
@@ -16,7 +21,7 @@ extern std::string PHYX_CITATION;
 
 void print_help() {
     std::cout << "Basic sequence simulator under the GTR model." << std::endl;
-    std::cout << "This will take fasta, fastq, phylip, and nexus formats from a file or STDIN." << std::endl;
+    std::cout << "This will take one or more newick or nexus trees from a file or STDIN." << std::endl;
     std::cout << std::endl;
     std::cout << "Usage: pxseqgen [OPTIONS]..." << std::endl;
     std::cout << std::endl;
@@ -26,6 +31,8 @@ void print_help() {
     std::cout << " -l, --length=INT       length of sequences to generate. default is 1000" << std::endl;
     std::cout << " -b, --basef=Input      comma-delimited base freqs in order: A,C,G,T. default is equal" << std::endl;
     std::cout << " -g, --gamma=INT        gamma shape value. default is no rate variation" << std::endl;
+    std::cout << " -d, --ncat=INT         number of discrete gamma rate categories. default is a" << std::endl;
+    std::cout << "                          continuous gamma" << std::endl;
     std::cout << " -i, --pinvar=FLOAT     proportion of invariable sites. default is 0.0" << std::endl;
     std::cout << " -r, --ratemat=Input    comma-delimited input values for rate matrix. default is JC69" << std::endl;
     std::cout << "                          order: A<->C,A<->G,A<->T,C<->G,C<->T,G<->T" << std::endl;
@@ -33,7 +40,14 @@ void print_help() {
     std::cout << "                        order is ARNDCQEGHILKMFPSTWYV" << std::endl;
     std::cout << " -q, --aabasefreq=Input AA frequencies, order: ARNDCQEGHILKMFPSTWYV" << std::endl;
     std::cout << " -c, --protein          run as amino acid" << std::endl;
-    std::cout << " -n, --nreps=INT        number of replicates" << std::endl;
+    std::cout << " -n, --nreps=INT        number of replicates per tree. default is 1" << std::endl;
+    std::cout << " -f, --prefix=STR       write each alignment to its own file, STR_<tree>.fa" << std::endl;
+    std::cout << "                          (STR_<tree>_<rep>.fa with -n), counting from 1." << std::endl;
+    std::cout << "                          default is all alignments to one output, in order" << std::endl;
+    std::cout << "                          and separated by a blank line" << std::endl;
+#ifdef OMP
+    std::cout << " -T, --nthreads=INT     number of threads (open mp) for trees and replicates, default=1" << std::endl;
+#endif
     std::cout << " -x, --seed=INT         random number seed, clock otherwise" << std::endl;
     std::cout << " -a, --ancestors        print the ancestral node sequences. default is no" << std::endl;
     std::cout << "                          use -p for the nodes labels" << std::endl;
@@ -60,11 +74,14 @@ static struct option const long_options[] =
     {"length", required_argument, NULL, 'l'},
     {"basef", required_argument, NULL, 'b'},
     {"gamma", required_argument, NULL, 'g'},
+    {"ncat", required_argument, NULL, 'd'},
     {"pinvar", required_argument, NULL, 'i'},
     {"ratemat", required_argument, NULL, 'r'},
     {"aaratemat", required_argument, NULL, 'w'},
     {"aabasef", required_argument, NULL, 'q'},
     {"nreps", required_argument, NULL, 'n'},
+    {"nthreads", required_argument, NULL, 'T'},
+    {"prefix", required_argument, NULL, 'f'},
     {"seed", required_argument, NULL, 'x'},
     {"ancestors", no_argument, NULL, 'a'},
     {"printnodelabels", no_argument, NULL, 'p'},
@@ -82,6 +99,7 @@ int main(int argc, char * argv[]) {
     log_call(argc, argv);
     
     bool outfileset = false;
+    bool prefixset = false;
     bool fileset = false;
     bool printpost = false;
     bool showancs = false;
@@ -96,6 +114,7 @@ int main(int argc, char * argv[]) {
     std::string inrates;
     std::string holdrates;
     std::string ancseq;
+    std::string prefix;
     char * outf = NULL;
     char * treef = NULL;
     std::vector<double> diag(20, 0.0);
@@ -103,10 +122,12 @@ int main(int argc, char * argv[]) {
     std::vector<double> aabasefreq(20, 0.05);
     std::vector<double> userrates;
     std::vector<double> multirates;
-    int nreps = 1; // not implemented at the moment
+    int nreps = 1;
+    int num_threads = 1;
     int seed = -1;
     int numpars = 0;
     float alpha = -1.0;
+    int ncats = 0; // continuous gamma
     std::vector< std::vector<double>> dmatrix;
     std::vector< std::vector<double> > aa_rmatrix(20, std::vector<double>(20, 1));
         for (unsigned int i = 0; i < aa_rmatrix.size(); i++) {
@@ -134,7 +155,7 @@ int main(int argc, char * argv[]) {
 
     while (1) {
         int oi = -1;
-        int c = getopt_long(argc, argv, "t:o:l:b:g:i:r:w:q:n:x:apcm:k:hVC", long_options, &oi);
+        int c = getopt_long(argc, argv, "t:o:l:b:g:d:i:r:w:q:n:T:f:x:apcm:k:hVC", long_options, &oi);
         if (c == -1) {
             break;
         }
@@ -246,6 +267,17 @@ int main(int argc, char * argv[]) {
                 break;
             case 'n':
                 nreps = string_to_int(optarg, "-n");
+                if (nreps < 1) {
+                    std::cerr << "Error: number of replicates must be positive. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
+            case 'T':
+                num_threads = string_to_int(optarg, "-T");
+                break;
+            case 'f':
+                prefixset = true;
+                prefix = optarg;
                 break;
             case 'x':
                 seed = string_to_int(optarg, "-x");
@@ -267,6 +299,13 @@ int main(int argc, char * argv[]) {
             case 'g':
                 alpha = string_to_float(optarg, "-g");
                 break;
+            case 'd':
+                ncats = string_to_int(optarg, "-d");
+                if (ncats < 1) {
+                    std::cerr << "Error: number of gamma categories must be positive. Exiting." << std::endl;
+                    exit(0);
+                }
+                break;
             case 'i':
                 pinvar = string_to_float(optarg, "-i");
                 break;
@@ -305,9 +344,20 @@ int main(int argc, char * argv[]) {
         }
     }
     
+    if (ncats > 0 && alpha <= 0.0) {
+        std::cerr << "Error: discrete gamma categories (-d) need a positive gamma shape (-g). Exiting."
+            << std::endl;
+        exit(0);
+    }
+    
     if (fileset && outfileset) {
         check_inout_streams_identical(treef, outf);
     }
+    if (outfileset && prefixset) {
+        std::cerr << "Error: give either an output file (-o) or a prefix (-f), not both. Exiting."
+            << std::endl;
+        exit(0);
+    }
     
     if (is_dna) {
         dmatrix = rmatrix;
@@ -364,26 +414,15 @@ int main(int argc, char * argv[]) {
         exit(0);
     }
     
-    // allow > 1 tree in input. passing but not yet using nreps
-    int treeCounter = 0;
+    // read every tree first, so they can be shared out among the threads
+    std::vector<Tree *> trees;
     bool going = true;
     if (ft == 1) { // newick. easy
         Tree * tree;
         while (going) {
             tree = read_next_tree_from_stream_newick (*pios, retstring, &going);
             if (tree != NULL) {
-                //std::cout << "Working on tree #" << treeCounter << std::endl;
-                SequenceGenerator SGen(seqlen, basefreq, dmatrix, tree, showancs,
-                    nreps, seed, alpha, pinvar, ancseq, printpost, multirates, aabasefreq, is_dna);
-                std::vector<Sequence> seqs = SGen.get_sequences();
-                for (unsigned int i = 0; i < seqs.size(); i++) {
-                    Sequence seq = seqs[i];
-                    (*poos) << ">" << seq.get_id() << std::endl;
-                    //std::cout << "Here" << std::endl;
-                    (*poos) << seq.get_sequence() << std::endl;
-                }
-                delete tree;
-                treeCounter++;
+                trees.push_back(tree);
             }
         }
     } else if (ft == 0) { // Nexus. need to worry about possible translation tables
@@ -395,19 +434,89 @@ int main(int argc, char * argv[]) {
             tree = read_next_tree_from_stream_nexus(*pios, retstring, ttexists,
                 &translation_table, &going);
             if (going == true) {
-                //std::cout << "Working on tree #" << treeCounter << std::endl;
-                SequenceGenerator SGen(seqlen, basefreq, dmatrix, tree, showancs,
-                    nreps, seed, alpha, pinvar, ancseq, printpost, multirates, aabasefreq, is_dna);
-                std::vector<Sequence> seqs = SGen.get_sequences();
+                trees.push_back(tree);
+            }
+        }
+    }
+    if (trees.empty()) {
+        std::cerr << "Error: no trees read. Exiting." << std::endl;
+        exit(0);
+    }
+    
+    if (printpost) {
+        SequenceGenerator::label_internal_nodes(trees[0]);
+        std::cout << getNewickString(trees[0]) << std::endl;
+        exit(0);
+    }
+    if (showancs) {
+        for (unsigned int i = 0; i < trees.size(); i++) {
+            SequenceGenerator::label_internal_nodes(trees[i]);
+        }
+    }
+    
+    // the model is the same for every tree (the multimodel changes to it are
+    // made by each simulation), so build it once
+    SeqGenModel model = build_seqgen_model(build_q_matrix(dmatrix, is_dna ? basefreq : aabasefreq));
+    
+    // each simulation needs its own random number stream, so fix a clock seed up front
+    if (seed == -1) {
+        seed = (int)(get_clock_seed() & 0x7fffffff);
+    }
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    
+    // every replicate of every tree is a separate job, shared out among the
+    // threads. each draws from its own random number stream (picked by the tree
+    // and replicate) and goes to its own file or is written to the stream as soon as
+    // it and the ones before it are done, so the output does not depend on the
+    // number of threads
+    int num_trees = (int)trees.size();
+    int num_jobs = num_trees * nreps;
+    #pragma omp parallel for ordered schedule(dynamic)
+    for (int job = 0; job < num_jobs; job++) {
+        int t = job / nreps;
+        int r = job % nreps;
+        SequenceGenerator SGen(seqlen, basefreq, dmatrix, trees[t], showancs,
+            t, r, seed, alpha, ncats, pinvar, ancseq, printpost, multirates, aabasefreq,
+            is_dna, &model);
+        std::vector<Sequence> seqs = SGen.get_sequences();
+        if (prefixset) {
+            std::string fname = prefix + "_" + std::to_string(t + 1);
+            if (nreps > 1) {
+                fname += "_" + std::to_string(r + 1);
+            }
+            fname += ".fa";
+            std::ofstream aout(fname.c_str());
+            for (unsigned int i = 0; i < seqs.size(); i++) {
+                aout << ">" << seqs[i].get_id() << std::endl;
+                aout << seqs[i].get_sequence() << std::endl;
+            }
+            aout.close();
+        } else {
+            #pragma omp ordered
+            {
+                if (job > 0) {
+                    (*poos) << std::endl;
+                }
                 for (unsigned int i = 0; i < seqs.size(); i++) {
-                    Sequence seq = seqs[i];
-                    (*poos) << ">" << seq.get_id() << std::endl;
-                    (*poos) << seq.get_sequence() << std::endl;
+                    (*poos) << ">" << seqs[i].get_id() << std::endl;
+                    (*poos) << seqs[i].get_sequence() << std::endl;
                 }
-                delete tree;
-                treeCounter++;
+                poos->flush();
             }
         }
     }
+    for (unsigned int i = 0; i < trees.size(); i++) {
+        delete trees[i];
+    }
+    if (fileset) {
+        fstr->close();
+        delete pios;
+    }
+    if (outfileset) {
+        ofstr->close();
+        delete poos;
+    }
     return EXIT_SUCCESS;
 }
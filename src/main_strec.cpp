@@ -4,6 +4,13 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <map>
+#include <sstream>
+#include <algorithm>
+
+#ifdef OMP
+#include <omp.h>
+#endif
 
 #include "node.h"
 #include "tree_reader.h"
@@ -40,6 +47,7 @@ void print_help() {
     std::cout << " -m, --outsttim=FILE output file for stochastic mapping duration" << std::endl;
     std::cout << " -p, --periods=NUMS  comma separated times" << std::endl;
     std::cout << " -l, --logf=FILE     log file, STOUT otherwise" << std::endl;
+    std::cout << " -T, --nthreads=INT  number of threads (open mp), default=1" << std::endl;
     std::cout << " -h, --help          display this help and exit" << std::endl;
     std::cout << " -V, --version       display version and exit" << std::endl;
     std::cout << " -C, --citation      display phyx citation and exit" << std::endl;
@@ -63,14 +71,15 @@ static struct option const long_options[] =
     {"outstnumany", required_argument, NULL, 'a'},
     {"periods", required_argument, NULL, 'p'},
     {"logf", required_argument, NULL, 'l'},
+    {"nthreads", required_argument, NULL, 'T'},
     {"help", no_argument, NULL, 'h'},
     {"version", no_argument, NULL, 'V'},
     {"citation", no_argument, NULL, 'C'},
     {NULL, 0, NULL, 0}
 };
 
-bool checkdata(Tree * intree, std::vector<Sequence> runseqs);
-bool checkdata(Tree * intree, std::vector<Sequence> runseqs) {
+bool checkdata(Tree * intree, std::vector<Sequence> runseqs, std::ostream * loos);
+bool checkdata(Tree * intree, std::vector<Sequence> runseqs, std::ostream * loos) {
     std::vector<std::string> ret;
     std::set<std::string> seqnames;
     std::set<std::string> treenames;
@@ -90,12 +99,437 @@ bool checkdata(Tree * intree, std::vector<Sequence> runseqs) {
     }
     for (it=v.begin() ; it != v.end(); it++) {
         if ((*it).size() > 1) {
-            std::cout << *it << std::endl;
+            (*loos) << *it << std::endl;
         }
     }
     return seqnames == treenames;
 }
 
+/*
+ * what was asked for in the arguments and the conf file. every site pattern
+ * is run with the same settings
+ */
+struct StrecSettings {
+    int nstates;
+    bool verbose;
+    bool dataz;
+    bool periodsset;
+    bool estimate;
+    std::string freeparams;
+    std::vector<double> period_times;
+    std::vector<std::vector<double> > ratematrix;
+    std::map<std::string, std::vector<std::string> > mrcas;
+    std::vector<std::string> ancstates;
+    std::vector<std::string> stochtime;
+    std::vector<std::string> stochnumber;
+    std::vector<std::string> stochnumber_any;
+};
+
+
+/*
+ * fit the model and do the reconstructions for the data of one site (already
+ * put into the wide view) on each tree. rows are labelled with site n. false
+ * if the site cannot be done (the data do not match a tree, or a probability
+ * came out negative), in which case the run stops after this site's rows
+ */
+bool reconstruct_site (const int& n, std::vector<Sequence>& runseqs,
+        const std::vector<int>& existing_states, const int& nstates_site_n,
+        std::vector<Tree *>& trees, const StrecSettings& st, std::ostream * loos,
+        std::ostream& ancout, std::ostream& stnumout, std::ostream& sttimeout,
+        std::ostream& sttnumout_any) {
+    for (unsigned int i=0; i < trees.size(); i++) {
+        if (st.verbose) {
+            (*loos) << i << std::endl;
+        }
+        std::vector<RateModel> rms;
+        RateModel rm(nstates_site_n);
+        StateReconstructor sr(rm, rms);
+        sr.set_log_stream(loos);
+        rm.setup_P(0.1, false);
+        if (st.periodsset == true) {
+            rms.push_back(rm);
+            for (unsigned int p=1; p < st.period_times.size(); p++) {
+                RateModel rm2(nstates_site_n);
+                rm2.setup_P(0.1, false);
+                rms.push_back(rm2);
+            }
+            sr.set_periods(st.period_times, rms);
+        }
+        sr.set_store_p_matrices(false);
+        Tree * tree = trees[i];
+        if (st.verbose) {
+            (*loos) << "tips: " << tree->getExternalNodeCount() << std::endl;
+        }
+        sr.set_tree(tree);
+        if (st.periodsset == true) {
+            sr.set_periods_model();
+        }
+        //checking that the data and the tree have the same names
+        if (checkdata(tree, runseqs, loos) == 0) {
+            return false;
+        }
+        bool same;
+        if (st.dataz == false) {
+            same = sr.set_tip_conditionals(runseqs);
+        } else {
+            same = sr.set_tip_conditionals_already_given(runseqs);
+        }
+        if (same == true) {
+            (*loos) << "skipping calculation" << std::endl;
+            continue;
+        }
+        double finallike; Superdouble totlike_sd;
+        if (st.periodsset == false) {
+            mat free_var(nstates_site_n, nstates_site_n);
+            free_var.fill(0);
+            int ct = 0;
+            if (st.freeparams == "_one_") {
+                ct = 1;
+            } else if (st.freeparams == "_all_") {
+                ct = 0;
+                for (int k=0; k < nstates_site_n; k++) {
+                    for (int j=0; j < nstates_site_n; j++) {
+                        if (k != j) {
+                            free_var(k, j) = ct;
+                            ct += 1;
+                        }
+                    }
+                }
+            }
+            if (st.verbose) {
+                (*loos) << free_var << std::endl;
+                (*loos) << ct << std::endl;
+            }
+            rm.neg_p = false;
+            (*loos) << "likelihood: " << sr.eval_likelihood() << std::endl;
+            //estimating the optimal rates
+            if (st.estimate) {//optimize
+                optimize_sr_nlopt(&rm, &sr, &free_var, ct);
+            } else { // requires that the st.ratematrix is available
+                for (int i=0; i < nstates_site_n; i++) {
+                    for (int j=0; j < nstates_site_n; j++) {
+                        free_var(i, j) = st.ratematrix[i][j];
+                    }
+                }
+            }
+            //end estimating
+            if (st.verbose) {
+                (*loos) << free_var << std::endl;
+            }
+            rm.setup_Q(free_var);
+            sr.set_store_p_matrices(true);
+            finallike = sr.eval_likelihood();
+            if (st.verbose) {
+                (*loos) << "final_likelihood: " << finallike << std::endl;
+                (*loos) << "p matrix cache hits: " << rm.get_p_cache_hits()
+                    << " misses: " << rm.get_p_cache_misses() << std::endl;
+            }
+        } else { //optimize with periods
+            std::vector<mat> periods_free_var(st.period_times.size());
+            int ct = 0;
+            if (st.freeparams == "_one_") {
+                ct = 1;
+                for (unsigned int s=0; s < st.period_times.size(); s++) {
+                    mat free_var(nstates_site_n, nstates_site_n);
+                    free_var.fill(0);
+                    periods_free_var[s] = free_var;
+                }
+            } else if (st.freeparams == "_all_") {
+                ct = 0;
+                for (unsigned int s=0; s < st.period_times.size(); s++) {
+                    mat free_var(nstates_site_n, nstates_site_n);
+                    free_var.fill(0);
+                    for (int k=0; k < nstates_site_n; k++) {
+                        for (int j=0; j < nstates_site_n; j++) {
+                        if (k != j) {
+                            free_var(k, j) = ct;
+                            ct += 1;
+                        }
+                        }
+                    }
+                    periods_free_var[s] = free_var;
+                }
+            }
+            if (st.verbose) {
+                for (unsigned int s=0; s < st.period_times.size(); s++) {
+                    (*loos) << periods_free_var[s] << std::endl;
+                }
+                (*loos) << ct << std::endl;
+            }
+            rm.neg_p = false;
+            (*loos) << "likelihood: " << sr.eval_likelihood() << std::endl;
+            optimize_sr_periods_nlopt(&rms, &sr, &periods_free_var, ct);
+            if (st.verbose) {
+                for (unsigned int s=0; s < st.period_times.size(); s++) {
+                    (*loos) << periods_free_var[s] << std::endl;
+                }
+                (*loos) << ct << std::endl;
+                (*loos) << "////////////////////////" << std::endl;
+            }
+            for (unsigned int s=0; s < st.period_times.size(); s++) {
+                rms[s].setup_Q(periods_free_var[s]);
+            }
+            sr.set_store_p_matrices(true);
+            finallike = sr.eval_likelihood();
+            if (st.verbose) {
+                (*loos) << "final_likelihood: " << finallike << std::endl;
+                unsigned long hits = 0, misses = 0;
+                for (unsigned int s=0; s < rms.size(); s++) {
+                    hits += rms[s].get_p_cache_hits();
+                    misses += rms[s].get_p_cache_misses();
+                }
+                (*loos) << "p matrix cache hits: " << hits
+                    << " misses: " << misses << std::endl;
+            }
+            (*loos) << "period set and so no ancestral states just yet" << std::endl;
+            continue;
+        }
+        if (st.verbose) {
+            (*loos) << "ancestral states" << std::endl;
+        }
+        sr.prepare_ancstate_reverse();
+        for (unsigned int j=0; j < st.ancstates.size(); j++) {
+        if (st.ancstates[j] == "_all_") {
+            std::vector<Superdouble> lhoods;
+            for (int l=0; l < tree->getInternalNodeCount(); l++) {
+                lhoods = sr.calculate_ancstate_reverse_sd(*tree->getInternalNode(l));
+                totlike_sd = calculate_vector_Superdouble_sum(lhoods);
+
+                //bool neg = false; // not used
+                int excount = 0;
+                double highest = 0;
+                int high = 0;
+                for (int k=0; k < st.nstates; k++) {
+                    if (existing_states[k] == 1) {
+                        if (double(lhoods[excount]/totlike_sd) > highest) {
+                            highest= double(lhoods[excount]/totlike_sd);
+                            high = k;
+                        }
+                        excount += 1;
+                    }
+                }
+                std::string s;
+                std::stringstream out;
+                out << high;
+                tree->getInternalNode(l)->setName(out.str());
+            }
+            ancout << getNewickString(tree) << std::endl;
+        } else {
+            std::vector<Superdouble> lhoods;
+            if (st.verbose) {
+                (*loos) << "node: " << tree->getMRCA(st.mrcas.at(st.ancstates[j]))->getName() << "\tmrca: " << st.ancstates[j] <<  std::endl;
+            }
+            ancout << n+1 << "\t" << i+1 << "\t" << st.ancstates[j] << "\t" << finallike;
+            lhoods = sr.calculate_ancstate_reverse_sd(*tree->getMRCA(st.mrcas.at(st.ancstates[j])));
+            totlike_sd = calculate_vector_Superdouble_sum(lhoods);
+            bool neg = false;
+            int excount = 0;
+            for (int k=0; k < st.nstates; k++) {
+                if (existing_states[k] == 1) {
+                    if (st.verbose) {
+                        (*loos) << double(lhoods[excount]/totlike_sd) << " ";//"(" << lhoods[excount] << ") ";
+                    }
+                    ancout << "\t" << double(lhoods[excount]/totlike_sd);
+                    if (double(lhoods[excount]/totlike_sd) < 0)
+                    neg = true;
+                    excount += 1;
+                } else {
+                    if (st.verbose) {
+                        (*loos) << "NA" << " ";
+                        ancout << "\t" << "NA";
+                    }
+                }
+            }
+            if (neg == true) {
+                return false;
+            }
+            ancout << std::endl;
+            if (st.verbose) {
+                (*loos) << std::endl;
+            }
+        }
+        }
+        if (st.verbose) {
+            (*loos) << std::endl;
+            (*loos) << "stochastic time" << std::endl;
+        }
+
+        for (unsigned int j=0; j < st.stochtime.size(); j++) {
+        if (tree->getMRCA(st.mrcas.at(st.stochtime[j]))->isRoot() == false) {
+            std::vector<double> lhoods;
+            if (st.verbose) {
+                (*loos)  << "mrca: " << st.stochtime[j] <<  std::endl;
+            }
+            sttimeout << n+1 << "\t" << i+1 << "\t" << st.stochtime[j]<< "\t" << finallike;
+            bool neg = false;
+            int excount = 0;
+            for (int k=0; k < st.nstates; k++) {
+                if (existing_states[k]==1) {
+                    sr.prepare_stochmap_reverse_all_nodes(excount, excount);
+                    sr.prepare_ancstate_reverse();
+                    std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(st.mrcas.at(st.stochtime[j])), true);
+                    double tnum = sum(stoch)/double(totlike_sd);
+                    double bl = tree->getMRCA(st.mrcas.at(st.stochtime[j]))->getBL();
+                    if (st.verbose) {
+                        (*loos) << tnum << " ";
+                    }
+                    sttimeout << "\t" << tnum/bl;
+                    if (tnum < 0) {
+                        neg = true;
+                    }
+                    excount += 1;
+                } else {
+                    if (st.verbose) {
+                        (*loos) << "NA" << " ";
+                    }
+                    sttimeout << "\t" << "NA";
+                }
+
+            }
+            sttimeout << std::endl;
+            if (st.verbose) {
+                (*loos) << std::endl;
+            }
+            if (neg == true) {
+                return false;
+            }
+        }
+        }
+        if (st.verbose) {
+            (*loos) << std::endl;
+            (*loos) << "stochastic number" << std::endl;
+        }
+        for (unsigned int j=0; j < st.stochnumber.size(); j++) {
+            if (tree->getMRCA(st.mrcas.at(st.stochnumber[j]))->isRoot() == false) {
+                std::vector<double> lhoods;
+                if (st.verbose) {
+                    (*loos) << "mrca: " << st.stochnumber[j] <<  std::endl;
+                }
+                stnumout << n+1 << "\t" << i+1 << "\t" << st.stochnumber[j]<< "\t" << finallike;
+                bool neg = false;
+                int excount = 0;
+                for (int k=0; k < st.nstates; k++) {
+                    if (existing_states[k]==1) {
+                        int excount2 = 0;
+                        for (int l=0; l < st.nstates; l++) {
+                            if (existing_states[l] == 1) {
+                                if (k == l) {
+                                    if (st.verbose) {
+                                        (*loos) << " - ";
+                                    }
+                                } else {
+                                    sr.prepare_stochmap_reverse_all_nodes(excount, excount2);
+                                    sr.prepare_ancstate_reverse();
+                                    std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(st.mrcas.at(st.stochnumber[j])), false);
+                                    double tnum = sum(stoch)/totlike_sd;
+                                    if (st.verbose) {
+                                        (*loos) << tnum << " ";
+                                    }
+                                    stnumout << "\t" << tnum;
+                                    if (tnum < 0) {
+                                        neg = true;
+                                    }
+                                }
+                                excount2 += 1;
+                            } else {
+                                if (st.verbose) {
+                                    (*loos) << "NA" << " ";
+                                }
+                                stnumout << "\t" << "NA";
+                            }
+                        }
+                        if (st.verbose) {
+                            (*loos) << std::endl;
+                        }
+                        excount += 1;
+                    } else {
+                        for (int l=0; l < st.nstates; l++) {
+                            if (k == l) {
+                                if (st.verbose) {
+                                    (*loos) << " - ";
+                                }
+                            } else {
+                                if (st.verbose) {
+                                    (*loos) << "NA" << " ";
+                                }
+                                stnumout << "\t" << "NA";
+                            }
+                        }
+                        if (st.verbose) {
+                            (*loos) << std::endl;
+                        }
+                    }
+                }
+                stnumout << std::endl;
+                if (st.verbose) {
+                    (*loos) << std::endl;
+                }
+                if (neg == true) {
+                    return false;
+                }
+            }
+        }
+        if (st.verbose) {
+            (*loos) << std::endl;
+        }
+        if (st.verbose) {
+            (*loos) << "stochastic number (any)" << std::endl;
+        }
+        if (st.stochnumber_any.size() > 0) {
+            sr.prepare_stochmap_reverse_all_nodes_all_matrices();
+            sr.prepare_ancstate_reverse();
+        }
+        for (unsigned int j=0; j < st.stochnumber_any.size(); j++) {
+            if (tree->getMRCA(st.mrcas.at(st.stochnumber_any[j]))->isRoot() == false) {
+                std::vector<double> lhoods;
+                if (st.verbose) {
+                    (*loos) << "node: " << tree->getMRCA(st.mrcas.at(st.stochnumber_any[j]))->getName() << " mrca: " << st.stochnumber_any[j] <<  std::endl;
+                }
+                sttnumout_any << n+1 << "\t" << i+1 << "\t" << st.stochnumber_any[j]<< "\t" << finallike;
+                std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(st.mrcas.at(st.stochnumber_any[j])), false);
+                double tnum = sum(stoch)/totlike_sd;
+                //(*loos) << sum(stoch) << " " << totlike << std::endl;
+                if (st.verbose) {
+                    (*loos) << tnum << " " ;
+                }
+                sttnumout_any << "\t" << tnum;
+                sttnumout_any << std::endl;
+                if (st.verbose) {
+                    (*loos) << std::endl;
+                }
+            }
+        }
+
+        //delete tree;
+    }
+    return true;
+}
+
+
+/*
+ * the rows of a site pattern are labelled with the first site that has it.
+ * relabel them for another site with the same pattern (newick rows from
+ * ancstates=_all_ have no label)
+ */
+void write_site_rows (std::ostream& out, const std::string& rows, const int& from,
+        const int& to) {
+    if (from == to) {
+        out << rows;
+        return;
+    }
+    std::string fromlabel = std::to_string(from + 1) + "\t";
+    std::string tolabel = std::to_string(to + 1) + "\t";
+    std::istringstream rowstream(rows);
+    std::string row;
+    while (getline(rowstream, row)) {
+        if (row.compare(0, fromlabel.size(), fromlabel) == 0) {
+            row.replace(0, fromlabel.size(), tolabel);
+        }
+        out << row << std::endl;
+    }
+}
+
+
 int main(int argc, char * argv[]) {
     
     log_call(argc, argv);
@@ -122,10 +556,11 @@ int main(int argc, char * argv[]) {
     std::string periodstring;
     std::vector<std::string> ptokens;
     std::vector<double> period_times;
+    int num_threads = 1;
     
     while (1) {
         int oi = -1;
-        int c = getopt_long(argc, argv, "d:t:c:o:n:m:a:l:p:hVwzC", long_options, &oi);
+        int c = getopt_long(argc, argv, "d:t:c:o:n:m:a:l:p:T:hVwzC", long_options, &oi);
         if (c == -1) {
             break;
         }
@@ -177,6 +612,9 @@ int main(int argc, char * argv[]) {
                 logfileset = true;
                 logf = strdup(optarg);
                 break;
+            case 'T':
+                num_threads = string_to_int(optarg, "-T");
+                break;
             case 'h':
                 print_help();
                 exit(0);
@@ -323,6 +761,7 @@ int main(int argc, char * argv[]) {
      */
     TreeReader tr;
     std::vector<Tree *> trees;
+    std::vector<std::string> treestrings;
     std::ifstream infile2(treef);
     if (!infile2) {
         std::cerr << "Error: could not open treefile. Exiting." << std::endl;
@@ -332,6 +771,7 @@ int main(int argc, char * argv[]) {
     while (getline(infile2, line)) {
         if (line.length() > 5) {
             trees.push_back(tr.readTree(line));
+            treestrings.push_back(line);
         }
     }
     infile2.close();
@@ -427,9 +867,106 @@ int main(int argc, char * argv[]) {
         sttnumout_any << "\tanystate";
         sttnumout_any << std::endl;
     }
+        
+    StrecSettings st;
+    st.nstates = nstates;
+    st.verbose = verbose;
+    st.dataz = dataz;
+    st.periodsset = periodsset;
+    st.estimate = estimate;
+    st.freeparams = freeparams;
+    st.period_times = period_times;
+    st.ratematrix = ratematrix;
+    st.mrcas = mrcas;
+    st.ancstates = ancstates;
+    st.stochtime = stochtime;
+    st.stochnumber = stochnumber;
+    st.stochnumber_any = stochnumber_any;
     
-    for (int n = 0; n < nsites; n++) {
-        (*loos) << "site: " << n+1 << std::endl;
+    /*
+     * sites with the same states for every taxon give the same results, so
+     * each site pattern is only run once (on its first site) and the rows are
+     * written out for each of its sites
+     */
+    std::vector<std::vector<std::string> > site_tokens(seqs.size());
+    std::vector<int> site_pattern(nsites, 0);
+    std::vector<int> pattern_sites(1, 0); // first site with each pattern
+    std::vector<int> pattern_weights(1, nsites);
+    if (datawide == false) {
+        for (unsigned int se = 0; se < seqs.size(); se++) {
+            tokenize(seqs[se].get_sequence(), site_tokens[se], "     ");
+            for (unsigned int j=0; j < site_tokens[se].size(); j++) {
+                trim_spaces(site_tokens[se][j]);
+            }
+        }
+        pattern_sites.clear();
+        pattern_weights.clear();
+        std::map<std::string, int> pattern_index;
+        for (int n = 0; n < nsites; n++) {
+            std::string key;
+            for (unsigned int se = 0; se < seqs.size(); se++) {
+                key += site_tokens[se][n] + " ";
+            }
+            std::map<std::string, int>::iterator it = pattern_index.find(key);
+            if (it == pattern_index.end()) {
+                site_pattern[n] = (int)pattern_sites.size();
+                pattern_index[key] = site_pattern[n];
+                pattern_sites.push_back(n);
+                pattern_weights.push_back(1);
+            } else {
+                site_pattern[n] = it->second;
+                pattern_weights[it->second] += 1;
+            }
+        }
+        if (verbose) {
+            (*loos) << "site patterns: " << pattern_sites.size() << std::endl;
+        }
+    }
+    int npatterns = (int)pattern_sites.size();
+    std::vector<std::string> ancrows(npatterns);
+    std::vector<std::string> stnumrows(npatterns);
+    std::vector<std::string> sttimerows(npatterns);
+    std::vector<std::string> stnumanyrows(npatterns);
+    
+    /*
+     * the site patterns are independent and are spread over the threads. each
+     * thread gets its own copies of the trees (set_tree hangs the likelihood
+     * workspace on the nodes) and the rows and log of each pattern are kept
+     * until the end so everything is written in site order
+     */
+    num_threads = std::max(1, std::min(num_threads, npatterns));
+    std::vector<std::vector<Tree *> > thread_trees(num_threads, trees);
+    for (int t = 1; t < num_threads; t++) {
+        for (unsigned int i = 0; i < treestrings.size(); i++) {
+            thread_trees[t][i] = tr.readTree(treestrings[i]);
+        }
+    }
+    std::vector<std::string> logrows(npatterns);
+    // the first pattern that could not be done. patterns are numbered in the
+    // order their first sites come, so the ones after it are not needed
+    int failed = npatterns;
+#ifdef OMP
+    omp_set_num_threads(num_threads);
+#endif
+    #pragma omp parallel for schedule(dynamic)
+    for (int pt = 0; pt < npatterns; pt++) {
+        int tid = 0;
+#ifdef OMP
+        tid = omp_get_thread_num();
+#endif
+        int curfailed;
+        #pragma omp atomic read
+        curfailed = failed;
+        if (pt > curfailed) {
+            continue;
+        }
+        std::ostringstream logpt;
+        std::ostream * ptloos = (num_threads > 1) ? &logpt : loos;
+        int n = pattern_sites[pt];
+        (*ptloos) << "site: " << n+1 << std::endl;
+        if (verbose && pattern_weights[pt] > 1) {
+            (*ptloos) << "sites with this pattern: " << pattern_weights[pt] << std::endl;
+        }
         /*
          * this converts the data and is a little long to accomodate datasets
          * with sites that don't have all the states but the results can still
@@ -441,18 +978,13 @@ int main(int argc, char * argv[]) {
         std::vector<int> existing_states(nstates, 0);
         if (datawide == false) {
             for (unsigned int se = 0;se<seqs.size();se++) {
-                std::vector<std::string> searchtokens;
-                tokenize(seqs[se].get_sequence(), searchtokens, "     ");
-                for (unsigned int j=0; j < searchtokens.size(); j++) {
-                    trim_spaces(searchtokens[j]);
-                }
                 std::string tseqs(nstates, '0');
-                if (searchtokens[n]=="?") {
+                if (site_tokens[se][n]=="?") {
                     for (int mse = 0; mse < nstates; mse++) {
                         tseqs.replace(mse, 1, "1");
                     }
                 } else {
-                    int pos = atoi(searchtokens[n].c_str());
+                    int pos = atoi(site_tokens[se][n].c_str());
                     tseqs.replace(pos, 1, "1");
                 }
                 for (int i=0; i < nstates; i++) {
@@ -483,7 +1015,6 @@ int main(int argc, char * argv[]) {
             }
         }
         //mapping the existing states to the full states
-        //int statecnt = 0; // not used
         for (int i=nstates-1; i >= 0; i--) {
             if (existing_states[i] == 1) {
                 continue;
@@ -495,365 +1026,46 @@ int main(int argc, char * argv[]) {
         }
 
         if (verbose) {
-            (*loos) << "states: " << nstates_site_n << std::endl;
-            (*loos) << "trees: ";
-        }
-        for (unsigned int i=0; i < trees.size(); i++) {
-            if (verbose) {
-                (*loos) << i << std::endl;
-            }
-            std::vector<RateModel> rms;
-            RateModel rm(nstates_site_n);
-            StateReconstructor sr(rm, rms);
-            rm.setup_P(0.1, false);
-            if (periodsset == true) {
-                rms.push_back(rm);
-                for (unsigned int p=1; p < period_times.size(); p++) {
-                    RateModel rm2(nstates_site_n);
-                    rm2.setup_P(0.1, false);
-                    rms.push_back(rm2);
-                }
-                sr.set_periods(period_times, rms);
-            }
-            sr.set_store_p_matrices(false);
-            Tree * tree = trees[i];
-            if (verbose) {
-                (*loos) << "tips: " << tree->getExternalNodeCount() << std::endl;
-            }
-            sr.set_tree(tree);
-            if (periodsset == true) {
-                sr.set_periods_model();
-            }
-            //checking that the data and the tree have the same names
-            if (checkdata(tree, runseqs) == 0) {
-                exit(0);
-            }
-            bool same;
-            if (dataz == false) {
-                same = sr.set_tip_conditionals(runseqs);
-            } else {
-                same = sr.set_tip_conditionals_already_given(runseqs);
-            }
-            if (same == true) {
-                (*loos) << "skipping calculation" << std::endl;
-                continue;
-            }
-            double finallike; Superdouble totlike_sd;
-            if (periodsset == false) {
-                mat free_var(nstates_site_n, nstates_site_n);
-                free_var.fill(0);
-                int ct = 0;
-                if (freeparams == "_one_") {
-                    ct = 1;
-                } else if (freeparams == "_all_") {
-                    ct = 0;
-                    for (int k=0; k < nstates_site_n; k++) {
-                        for (int j=0; j < nstates_site_n; j++) {
-                            if (k != j) {
-                                free_var(k, j) = ct;
-                                ct += 1;
-                            }
-                        }
-                    }
-                }
-                if (verbose) {
-                    (*loos) << free_var << std::endl;
-                    (*loos) << ct << std::endl;
-                }
-                rm.neg_p = false;
-                std::cout << "likelihood: " << sr.eval_likelihood() << std::endl;
-                //estimating the optimal rates
-                if (estimate) {//optimize
-                    optimize_sr_nlopt(&rm, &sr, &free_var, ct);
-                } else { // requires that the ratematrix is available
-                    for (int i=0; i < nstates_site_n; i++) {
-                        for (int j=0; j < nstates_site_n; j++) {
-                            free_var(i, j) = ratematrix[i][j];
-                        }
-                    }
-                }
-                //end estimating
-                if (verbose) {
-                    (*loos) << free_var << std::endl;
-                }
-                rm.setup_Q(free_var);
-                sr.set_store_p_matrices(true);
-                finallike = sr.eval_likelihood();
-                if (verbose) {
-                    (*loos) << "final_likelihood: " << finallike << std::endl;
-                }
-            } else { //optimize with periods
-                std::vector<mat> periods_free_var(period_times.size());
-                int ct = 0;
-                if (freeparams == "_one_") {
-                    ct = 1;
-                    for (unsigned int s=0; s < period_times.size(); s++) {
-                        mat free_var(nstates_site_n, nstates_site_n);
-                        free_var.fill(0);
-                        periods_free_var[s] = free_var;
-                    }
-                } else if (freeparams == "_all_") {
-                    ct = 0;
-                    for (unsigned int s=0; s < period_times.size(); s++) {
-                        mat free_var(nstates_site_n, nstates_site_n);
-                        free_var.fill(0);
-                        for (int k=0; k < nstates_site_n; k++) {
-                            for (int j=0; j < nstates_site_n; j++) {
-                            if (k != j) {
-                                free_var(k, j) = ct;
-                                ct += 1;
-                            }
-                            }
-                        }
-                        periods_free_var[s] = free_var;
-                    }
-                }
-                if (verbose) {
-                    for (unsigned int s=0; s < period_times.size(); s++) {
-                        (*loos) << periods_free_var[s] << std::endl;
-                    }
-                    (*loos) << ct << std::endl;
-                }
-                rm.neg_p = false;
-                std::cout << "likelihood: " << sr.eval_likelihood() << std::endl;
-                optimize_sr_periods_nlopt(&rms, &sr, &periods_free_var, ct);
-                if (verbose) {
-                    for (unsigned int s=0; s < period_times.size(); s++) {
-                        (*loos) << periods_free_var[s] << std::endl;
-                    }
-                    (*loos) << ct << std::endl;
-                    std::cout << "////////////////////////" << std::endl;
-                }
-                for (unsigned int s=0; s < period_times.size(); s++) {
-                    rms[s].setup_Q(periods_free_var[s]);
-                }
-                sr.set_store_p_matrices(true);
-                finallike = sr.eval_likelihood();
-                if (verbose) {
-                    (*loos) << "final_likelihood: " << finallike << std::endl;
-                }
-                std::cout << "period set and so no ancestral states just yet" << std::endl;
-                continue;
-            }
-            if (verbose) {
-                (*loos) << "ancestral states" << std::endl;
-            }
-            sr.prepare_ancstate_reverse();
-            for (unsigned int j=0; j < ancstates.size(); j++) {
-            if (ancstates[j] == "_all_") {
-                std::vector<Superdouble> lhoods;
-                for (int l=0; l < tree->getInternalNodeCount(); l++) {
-                    lhoods = sr.calculate_ancstate_reverse_sd(*tree->getInternalNode(l));
-                    totlike_sd = calculate_vector_Superdouble_sum(lhoods);
-
-                    //bool neg = false; // not used
-                    int excount = 0;
-                    double highest = 0;
-                    int high = 0;
-                    for (int k=0; k < nstates; k++) {
-                        if (existing_states[k] == 1) {
-                            if (double(lhoods[excount]/totlike_sd) > highest) {
-                                highest= double(lhoods[excount]/totlike_sd);
-                                high = k;
-                            }
-                            excount += 1;
-                        }
-                    }
-                    std::string s;
-                    std::stringstream out;
-                    out << high;
-                    tree->getInternalNode(l)->setName(out.str());
-                }
-                ancout << getNewickString(tree) << std::endl;
-            } else {
-                std::vector<Superdouble> lhoods;
-                if (verbose) {
-                    (*loos) << "node: " << tree->getMRCA(mrcas[ancstates[j]])->getName() << "\tmrca: " << ancstates[j] <<  std::endl;
-                }
-                ancout << n+1 << "\t" << i+1 << "\t" << ancstates[j] << "\t" << finallike;
-                lhoods = sr.calculate_ancstate_reverse_sd(*tree->getMRCA(mrcas[ancstates[j]]));
-                totlike_sd = calculate_vector_Superdouble_sum(lhoods);
-                bool neg = false;
-                int excount = 0;
-                for (int k=0; k < nstates; k++) {
-                    if (existing_states[k] == 1) {
-                        if (verbose) {
-                            (*loos) << double(lhoods[excount]/totlike_sd) << " ";//"(" << lhoods[excount] << ") ";
-                        }
-                        ancout << "\t" << double(lhoods[excount]/totlike_sd);
-                        if (double(lhoods[excount]/totlike_sd) < 0)
-                        neg = true;
-                        excount += 1;
-                    } else {
-                        if (verbose) {
-                            (*loos) << "NA" << " ";
-                            ancout << "\t" << "NA";
-                        }
-                    }
-                }
-                if (neg == true) {
-                    exit(0);
-                }
-                ancout << std::endl;
-                if (verbose) {
-                    (*loos) << std::endl;
-                }
-            }
-            }
-            if (verbose) {
-                (*loos) << std::endl;
-                (*loos) << "stochastic time" << std::endl;
-            }
-
-            for (unsigned int j=0; j < stochtime.size(); j++) {
-            if (tree->getMRCA(mrcas[stochtime[j]])->isRoot() == false) {
-                std::vector<double> lhoods;
-                if (verbose) {
-                    (*loos)  << "mrca: " << stochtime[j] <<  std::endl;
-                }
-                sttimeout << n+1 << "\t" << i+1 << "\t" << stochtime[j]<< "\t" << finallike;
-                bool neg = false;
-                int excount = 0;
-                for (int k=0; k < nstates; k++) {
-                    if (existing_states[k]==1) {
-                        sr.prepare_stochmap_reverse_all_nodes(excount, excount);
-                        sr.prepare_ancstate_reverse();
-                        std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(mrcas[stochtime[j]]), true);
-                        double tnum = sum(stoch)/double(totlike_sd);
-                        double bl = tree->getMRCA(mrcas[stochtime[j]])->getBL();
-                        if (verbose) {
-                            (*loos) << tnum << " ";
-                        }
-                        sttimeout << "\t" << tnum/bl;
-                        if (tnum < 0) {
-                            neg = true;
-                        }
-                        excount += 1;
-                    } else {
-                        if (verbose) {
-                            (*loos) << "NA" << " ";
-                        }
-                        sttimeout << "\t" << "NA";
-                    }
-
-                }
-                sttimeout << std::endl;
-                if (verbose) {
-                    (*loos) << std::endl;
-                }
-                if (neg == true) {
-                    exit(0);
-                }
-            }
-            }
-            if (verbose) {
-                (*loos) << std::endl;
-                (*loos) << "stochastic number" << std::endl;
-            }
-            for (unsigned int j=0; j < stochnumber.size(); j++) {
-                if (tree->getMRCA(mrcas[stochnumber[j]])->isRoot() == false) {
-                    std::vector<double> lhoods;
-                    if (verbose) {
-                        (*loos) << "mrca: " << stochnumber[j] <<  std::endl;
-                    }
-                    stnumout << n+1 << "\t" << i+1 << "\t" << stochnumber[j]<< "\t" << finallike;
-                    bool neg = false;
-                    int excount = 0;
-                    for (int k=0; k < nstates; k++) {
-                        if (existing_states[k]==1) {
-                            int excount2 = 0;
-                            for (int l=0; l < nstates; l++) {
-                                if (existing_states[l] == 1) {
-                                    if (k == l) {
-                                        if (verbose) {
-                                            (*loos) << " - ";
-                                        }
-                                    } else {
-                                        sr.prepare_stochmap_reverse_all_nodes(excount, excount2);
-                                        sr.prepare_ancstate_reverse();
-                                        std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(mrcas[stochnumber[j]]), false);
-                                        double tnum = sum(stoch)/totlike_sd;
-                                        if (verbose) {
-                                            (*loos) << tnum << " ";
-                                        }
-                                        stnumout << "\t" << tnum;
-                                        if (tnum < 0) {
-                                            neg = true;
-                                        }
-                                    }
-                                    excount2 += 1;
-                                } else {
-                                    if (verbose) {
-                                        (*loos) << "NA" << " ";
-                                    }
-                                    stnumout << "\t" << "NA";
-                                }
-                            }
-                            if (verbose) {
-                                (*loos) << std::endl;
-                            }
-                            excount += 1;
-                        } else {
-                            for (int l=0; l < nstates; l++) {
-                                if (k == l) {
-                                    if (verbose) {
-                                        (*loos) << " - ";
-                                    }
-                                } else {
-                                    if (verbose) {
-                                        (*loos) << "NA" << " ";
-                                    }
-                                    stnumout << "\t" << "NA";
-                                }
-                            }
-                            if (verbose) {
-                                (*loos) << std::endl;
-                            }
-                        }
-                    }
-                    stnumout << std::endl;
-                    if (verbose) {
-                        (*loos) << std::endl;
-                    }
-                    if (neg == true) {
-                        exit(0);
-                    }
-                }
-            }
-            if (verbose) {
-                (*loos) << std::endl;
-            }
-            if (verbose) {
-                (*loos) << "stochastic number (any)" << std::endl;
-            }
-            if (stochnumber_any.size() > 0) {
-                sr.prepare_stochmap_reverse_all_nodes_all_matrices();
-                sr.prepare_ancstate_reverse();
-            }
-            for (unsigned int j=0; j < stochnumber_any.size(); j++) {
-                if (tree->getMRCA(mrcas[stochnumber_any[j]])->isRoot() == false) {
-                    std::vector<double> lhoods;
-                    if (verbose) {
-                        (*loos) << "node: " << tree->getMRCA(mrcas[stochnumber_any[j]])->getName() << " mrca: " << stochnumber_any[j] <<  std::endl;
-                    }
-                    sttnumout_any << n+1 << "\t" << i+1 << "\t" << stochnumber_any[j]<< "\t" << finallike;
-                    std::vector<double> stoch = sr.calculate_reverse_stochmap(*tree->getMRCA(mrcas[stochnumber_any[j]]), false);
-                    double tnum = sum(stoch)/totlike_sd;
-                    //(*loos) << sum(stoch) << " " << totlike << std::endl;
-                    if (verbose) {
-                        (*loos) << tnum << " " ;
-                    }
-                    sttnumout_any << "\t" << tnum;
-                    sttnumout_any << std::endl;
-                    if (verbose) {
-                        (*loos) << std::endl;
-                    }
+            (*ptloos) << "states: " << nstates_site_n << std::endl;
+            (*ptloos) << "trees: ";
+        }
+        std::ostringstream ancpt, stnumpt, sttimept, stnumanypt;
+        if (reconstruct_site(n, runseqs, existing_states, nstates_site_n,
+                thread_trees[tid], st, ptloos, ancpt, stnumpt, sttimept, stnumanypt) == false) {
+            #pragma omp critical (strec_failed)
+            {
+                if (pt < failed) {
+                    failed = pt;
                 }
             }
-
-            //delete tree;
+        }
+        ancrows[pt] = ancpt.str();
+        stnumrows[pt] = stnumpt.str();
+        sttimerows[pt] = sttimept.str();
+        stnumanyrows[pt] = stnumanypt.str();
+        logrows[pt] = logpt.str();
+    }
+    for (int t = 1; t < num_threads; t++) {
+        for (unsigned int i = 0; i < thread_trees[t].size(); i++) {
+            delete thread_trees[t][i];
         }
     }
+    
+    // everything up to the site that failed is written, as if the sites had
+    // been done one at a time
+    for (int pt = 0; pt < npatterns && pt <= failed; pt++) {
+        (*loos) << logrows[pt];
+    }
+    for (int n = 0; n < nsites; n++) {
+        int pt = site_pattern[n];
+        if (failed < npatterns && n > pattern_sites[failed]) {
+            break;
+        }
+        write_site_rows(ancout, ancrows[pt], pattern_sites[pt], n);
+        write_site_rows(stnumout, stnumrows[pt], pattern_sites[pt], n);
+        write_site_rows(sttimeout, sttimerows[pt], pattern_sites[pt], n);
+        write_site_rows(sttnumout_any, stnumanyrows[pt], pattern_sites[pt], n);
+    }
     if (ancstates.size() > 0  && outancfileset == true) {
         ancout.close();
     }
@@ -868,5 +1080,10 @@ int main(int argc, char * argv[]) {
         logout->close();
         delete loos;
     }
+    if (failed < npatterns) {
+        std::cerr << "Error: site " << pattern_sites[failed] + 1
+            << " could not be reconstructed, so the sites after it were not done. Exiting." << std::endl;
+        exit(0);
+    }
     return EXIT_SUCCESS;
 }
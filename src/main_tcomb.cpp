@@ -207,6 +207,7 @@ int main(int argc, char * argv[]) {
             Node * oldroot = addtree->getRoot();
             oldroot->setParent(*connecthere);
             connecthere->addChild(*oldroot);
+            bigtree->invalidateLCAIndex();
             addtree->setRoot(connecthere);
             bool didit = false;
             while (diffnds.size() > 0) {
@@ -12,8 +12,8 @@ using namespace arma;
 
 
 typedef struct {
-    rowvec x;
-    mat ovcv;
+    std::vector<double> x;
+    const ContPruner * pruner;
 } analysis_data;
 
 
@@ -28,9 +28,7 @@ double nlopt_bm_sr (unsigned n, const double *x, double *grad, void *data) {
     }
    std::cout << x[0] << " " << x[1] << std::endl;
     analysis_data * d = (analysis_data *) data;
-    mat tvcv = (d->ovcv) * x[1];
-    rowvec m = rowvec(d->x.n_cols); m.fill(x[0]);
-    double like = norm_pdf_multivariate(d->x, m, tvcv);
+    double like = exp(d->pruner->calc_bm_loglike(d->x, x[0], x[1]));
     return -like;
 }
 
@@ -41,33 +39,20 @@ double nlopt_bm_sr_log (unsigned n, const double *x, double *grad, void *data) {
     }
     //std::cout << x[0] << " " << x[1] << std::endl;
     analysis_data * d = (analysis_data *) data;
-    mat tvcv = (d->ovcv) * x[1];
-    rowvec m = rowvec(d->x.n_cols); m.fill(x[0]);
-    double like = norm_log_pdf_multivariate(d->x, m, tvcv);
+    double like = d->pruner->calc_bm_loglike(d->x, x[0], x[1]);
     return -like;
 }
 
 
 /*
- * single alpha ou
+ * single alpha ou. both the root and the optimum are x[0]
  */
 double nlopt_ou_sr_log (unsigned n, const double *x, double *grad, void *data) {
     if (x[1] <= 0 || x[2] <= 0) {
         return LARGE;
     }
-    double alpha = x[2];
     analysis_data * d = (analysis_data *) data;
-    mat vcvDiag(d->ovcv.n_cols,d->ovcv.n_cols); vcvDiag.zeros(); 
-    vcvDiag.diag() = (d->ovcv).diag();
-    mat tm(vcvDiag.n_cols,vcvDiag.n_cols);
-    tm.ones();
-    mat diagi = trans(vcvDiag * tm);
-    mat diagj = vcvDiag * tm;
-    mat Tij = diagi + diagj - (2 * d->ovcv);
-    mat ouvcv = (1. / (2. * alpha)) * exp(-alpha * Tij) % (1. - exp(-2. * alpha * d->ovcv));
-    ouvcv = ouvcv * x[1];
-    rowvec m = rowvec(d->x.n_cols); m.fill(x[0]);
-    double like = norm_log_pdf_multivariate(d->x,m,ouvcv);
+    double like = d->pruner->calc_ou_loglike(d->x, x[0], x[1], x[2]);
     return -like;
 }
 
@@ -92,10 +77,15 @@ double nlopt_bm_bl (unsigned n, const double *x, double *grad, void *data) {
 }
 
 
-std::vector<double> optimize_single_rate_bm_nlopt (rowvec& _x, mat& _vcv, bool log) {
+/*
+ * _x holds the tip values in getExternalNode order of the tree of the pruner.
+ * each evaluation is O(n) (no vcv)
+ */
+std::vector<double> optimize_single_rate_bm_nlopt (std::vector<double>& _x,
+        const ContPruner& pruner, bool log) {
     analysis_data a;
     a.x = _x;
-    a.ovcv = _vcv;
+    a.pruner = &pruner;
 
     //nlopt::opt opt(nlopt::LN_NELDERMEAD, 2);
     //nlopt::opt opt(nlopt::LN_BOBYQA,2);
@@ -126,10 +116,11 @@ std::vector<double> optimize_single_rate_bm_nlopt (rowvec& _x, mat& _vcv, bool l
     return results;
 }
 
-std::vector<double> optimize_single_rate_bm_ou_nlopt (rowvec& _x, mat& _vcv) {
+std::vector<double> optimize_single_rate_bm_ou_nlopt (std::vector<double>& _x,
+        const ContPruner& pruner) {
     analysis_data a;
     a.x = _x;
-    a.ovcv = _vcv;
+    a.pruner = &pruner;
 
     //nlopt::opt opt(nlopt::LN_NELDERMEAD, 3);
     //BOBYQA is better but the other finishes more
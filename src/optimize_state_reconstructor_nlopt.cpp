@@ -2,6 +2,9 @@
 //#include <stdio.h>
 #include <nlopt.hpp>
 #include <cmath>
+#include <vector>
+#include <limits>
+#include <stdexcept>
 
 #include "optimize_state_reconstructor_nlopt.h"
 #include "state_reconstructor.h"
@@ -10,13 +13,39 @@
 #include <armadillo>
 using namespace arma;
 
+// the objective rejects rates at or above 1000
+#define MAX_RATE 999.999
 
-StateReconstructor * nloptsr;
-RateModel * nloptrm;
-mat * nloptfree_variables;
 
+/*
+ * handed to the objective through nlopt (rather than kept in globals) so
+ * that several sites can be optimized at the same time
+ */
+typedef struct {
+    StateReconstructor * sr;
+    RateModel * rm;
+    mat * free_variables;
+    // the best point the objective has been asked about, so a failed run
+    // still leaves something to start the next one from
+    std::vector<double> best_x;
+    double best_like;
+} sr_data;
 
+
+/*
+ * when nlopt asks for a gradient (grad != NULL) the derivatives of the
+ * cells sharing a free parameter are summed into it
+ */
 double nlopt_sr (unsigned n, const double *x, double *grad, void *my_func_data) {
+    sr_data * d = (sr_data *) my_func_data;
+    StateReconstructor * nloptsr = d->sr;
+    RateModel * nloptrm = d->rm;
+    mat * nloptfree_variables = d->free_variables;
+    if (grad != NULL) {
+        for (unsigned int i=0; i < n; i++) {
+            grad[i] = 0.0;
+        }
+    }
     for (unsigned int i=0; i < nloptfree_variables->n_rows; i++) {
         for (unsigned int j=0; j < nloptfree_variables->n_cols; j++) {
             if (i != j) {
@@ -29,23 +58,48 @@ double nlopt_sr (unsigned n, const double *x, double *grad, void *my_func_data)
     }
     double like;
     nloptrm->set_Q_diag();
-    like = nloptsr->eval_likelihood();
-    if (nloptrm->neg_p == true) {
-        like = 10000000000000;
+    if (grad != NULL) {
+        std::vector<mat> grads;
+        like = nloptsr->eval_likelihood_gradient(grads);
+        for (unsigned int i=0; i < nloptfree_variables->n_rows; i++) {
+            for (unsigned int j=0; j < nloptfree_variables->n_cols; j++) {
+                if (i != j) {
+                    grad[int((*nloptfree_variables)(i, j))] += grads[0](i, j);
+                }
+            }
+        }
+    } else {
+        like = nloptsr->eval_likelihood();
     }
+    bool bad = (nloptrm->neg_p == true);
     //std::cout << like << std::endl;
-    if (like < 0 || like == std::numeric_limits<double>::infinity()) {
+    if (like < 0 || like == std::numeric_limits<double>::infinity() || std::isnan(like)) {
+        bad = true;
+    }
+    if (bad == true) {
         like = 10000000000000;
+        if (grad != NULL) {
+            for (unsigned int i=0; i < n; i++) {
+                grad[i] = 0.0;
+            }
+        }
+    } else if (like < d->best_like) {
+        d->best_like = like;
+        d->best_x.assign(x, x + n);
     }
     return like;
 }
 
 void optimize_sr_nlopt (RateModel * _rm,StateReconstructor * _sr, mat * _free_mask, int _nfree) {
-    nloptsr = _sr;
-    nloptrm = _rm;
-    nloptfree_variables = _free_mask;
+    sr_data data;
+    data.sr = _sr;
+    data.rm = _rm;
+    data.free_variables = _free_mask;
+    data.best_like = std::numeric_limits<double>::infinity();
 
-    nlopt::opt opt(nlopt::LN_NELDERMEAD, _nfree);
+    // the gradient comes from StateReconstructor::eval_likelihood_gradient
+    nlopt::opt opt(nlopt::LD_LBFGS, _nfree);
+    //nlopt::opt opt(nlopt::LN_NELDERMEAD, _nfree);
     //nlopt::opt opt(nlopt::LN_BOBYQA, _nfree);
     //nlopt::opt opt(nlopt::LN_PRAXIS, _nfree);
     //nlopt::opt opt(nlopt::LN_SBPLX, _nfree);
@@ -53,9 +107,10 @@ void optimize_sr_nlopt (RateModel * _rm,StateReconstructor * _sr, mat * _free_ma
     //nlopt::opt opt(nlopt::LN_NEWUOA, _nfree);
 
     opt.set_lower_bounds(0.0000);
-    opt.set_upper_bounds(100000);
-    opt.set_min_objective(nlopt_sr, NULL);
+    opt.set_upper_bounds(MAX_RATE);
+    opt.set_min_objective(nlopt_sr, &data);
     opt.set_xtol_rel(0.001);
+    opt.set_ftol_abs(0.000001);
     opt.set_maxeval(5000);
 
     std::vector<double> x(_nfree,0);
@@ -69,8 +124,32 @@ void optimize_sr_nlopt (RateModel * _rm,StateReconstructor * _sr, mat * _free_ma
         //std::cout << std::endl;
     }
 
-    //double minf;
-    std::vector<double> result = opt.optimize(x);
+    data.best_x = x;
+    double minf;
+    std::vector<double> result(x);
+    try {
+        opt.optimize(result, minf);
+    } catch (nlopt::roundoff_limited& e) {
+        // as good as it gets
+        result = data.best_x;
+    } catch (std::runtime_error& e) {
+        // lbfgs can give up on a flat or boxed-in surface. go derivative
+        // free from the best point it reached
+        nlopt::opt nm(nlopt::LN_NELDERMEAD, _nfree);
+        nm.set_lower_bounds(0.0000);
+        nm.set_upper_bounds(MAX_RATE);
+        nm.set_min_objective(nlopt_sr, &data);
+        nm.set_xtol_rel(0.001);
+        nm.set_ftol_abs(0.000001);
+        nm.set_maxeval(5000);
+        result = data.best_x;
+        try {
+            nm.optimize(result, minf);
+        } catch (std::runtime_error& e) {
+            // roundoff or a failure: keep the best point either run found
+        }
+        result = data.best_x;
+    }
     for (unsigned int i=0; i < _rm->get_Q().n_rows; i++) {
         for (unsigned int j=0; j < _rm->get_Q().n_cols; j++) {
             if (i != j) {
@@ -3,6 +3,8 @@
 #include <nlopt.hpp>
 #include <cmath>
 #include <vector>
+#include <limits>
+#include <stdexcept>
 
 #include "optimize_state_reconstructor_periods_nlopt.h"
 #include "state_reconstructor.h"
@@ -11,13 +13,32 @@
 #include <armadillo>
 using namespace arma;
 
+// the objective rejects rates at or above 1000
+#define MAX_RATE 999.999
 
-StateReconstructor * nloptsr_periods;
-std::vector<RateModel> * nloptrm_periods;
-std::vector<mat> * nloptfree_variables_periods;
+
+// handed to the objective through nlopt so sites can run at the same time
+typedef struct {
+    StateReconstructor * sr;
+    std::vector<RateModel> * rms;
+    std::vector<mat> * free_variables;
+    // the best point the objective has been asked about, so a failed run
+    // still leaves something to start the next one from
+    std::vector<double> best_x;
+    double best_like;
+} sr_periods_data;
 
 
 double nlopt_sr_periods (unsigned n, const double *x, double *grad, void *my_func_data) {
+    sr_periods_data * d = (sr_periods_data *) my_func_data;
+    StateReconstructor * nloptsr_periods = d->sr;
+    std::vector<RateModel> * nloptrm_periods = d->rms;
+    std::vector<mat> * nloptfree_variables_periods = d->free_variables;
+    if (grad != NULL) {
+        for (unsigned int i=0; i < n; i++) {
+            grad[i] = 0.0;
+        }
+    }
     for (unsigned int k=0; k < nloptfree_variables_periods->size(); k++) {
         for (unsigned int i=0; i < (*nloptfree_variables_periods)[k].n_rows; i++) {
             for (unsigned int j=0; j < (*nloptfree_variables_periods)[k].n_cols; j++) {
@@ -34,27 +55,57 @@ double nlopt_sr_periods (unsigned n, const double *x, double *grad, void *my_fun
     for (unsigned int i=0; i < nloptrm_periods->size(); i++) {
         nloptrm_periods->at(i).set_Q_diag();
     }
-    like = nloptsr_periods->eval_likelihood();
+    if (grad != NULL) {
+        std::vector<mat> grads;
+        like = nloptsr_periods->eval_likelihood_gradient(grads);
+        for (unsigned int k=0; k < nloptfree_variables_periods->size(); k++) {
+            for (unsigned int i=0; i < (*nloptfree_variables_periods)[k].n_rows; i++) {
+                for (unsigned int j=0; j < (*nloptfree_variables_periods)[k].n_cols; j++) {
+                    if (i != j) {
+                        grad[int(nloptfree_variables_periods->at(k)(i,j))] += grads[k](i,j);
+                    }
+                }
+            }
+        }
+    } else {
+        like = nloptsr_periods->eval_likelihood();
+    }
+    bool bad = false;
     for (unsigned int i=0; i < nloptrm_periods->size(); i++) {
         if (nloptrm_periods->at(i).neg_p == true) {
-            like = 10000000000000;
+            bad = true;
             break;
         }
     }
 //    std::cout << like << std::endl;
-    if (like < 0 || like == std::numeric_limits<double>::infinity()) {
+    if (like < 0 || like == std::numeric_limits<double>::infinity() || std::isnan(like)) {
+        bad = true;
+    }
+    if (bad == true) {
         like = 10000000000000;
+        if (grad != NULL) {
+            for (unsigned int i=0; i < n; i++) {
+                grad[i] = 0.0;
+            }
+        }
+    } else if (like < d->best_like) {
+        d->best_like = like;
+        d->best_x.assign(x, x + n);
     }
     return like;
 }
 
 void optimize_sr_periods_nlopt (std::vector<RateModel> * _rm,StateReconstructor * _sr,
         std::vector<mat> * _free_mask, int _nfree) {
-    nloptsr_periods = _sr;
-    nloptrm_periods = _rm;
-    nloptfree_variables_periods = _free_mask;
+    sr_periods_data data;
+    data.sr = _sr;
+    data.rms = _rm;
+    data.free_variables = _free_mask;
+    data.best_like = std::numeric_limits<double>::infinity();
     
-    nlopt::opt opt(nlopt::LN_NELDERMEAD, _nfree);
+    // the gradient comes from StateReconstructor::eval_likelihood_gradient
+    nlopt::opt opt(nlopt::LD_LBFGS, _nfree);
+    //nlopt::opt opt(nlopt::LN_NELDERMEAD, _nfree);
     //nlopt::opt opt(nlopt::LN_BOBYQA, _nfree);
     //nlopt::opt opt(nlopt::LN_PRAXIS, _nfree);
     //nlopt::opt opt(nlopt::LN_SBPLX, _nfree);
@@ -62,9 +113,10 @@ void optimize_sr_periods_nlopt (std::vector<RateModel> * _rm,StateReconstructor
     //nlopt::opt opt(nlopt::LN_NEWUOA, _nfree);
     
     opt.set_lower_bounds(0.0000);
-    opt.set_upper_bounds(100000);
-    opt.set_min_objective(nlopt_sr_periods, NULL);
+    opt.set_upper_bounds(MAX_RATE);
+    opt.set_min_objective(nlopt_sr_periods, &data);
     opt.set_xtol_rel(0.001);
+    opt.set_ftol_abs(0.000001);
     opt.set_maxeval(10000);
     
     std::vector<double> x(_nfree,0);
@@ -76,11 +128,35 @@ void optimize_sr_periods_nlopt (std::vector<RateModel> * _rm,StateReconstructor
                     //std::cout << x[int((*_free_mask)[k](i,j))] << " ";
                 }
             }
-            std::cout << std::endl;
+            //std::cout << std::endl;
+        }
+    }
+    data.best_x = x;
+    double minf;
+    std::vector<double> result(x);
+    try {
+        opt.optimize(result, minf);
+    } catch (nlopt::roundoff_limited& e) {
+        // as good as it gets
+        result = data.best_x;
+    } catch (std::runtime_error& e) {
+        // lbfgs can give up on a flat or boxed-in surface. go derivative
+        // free from the best point it reached
+        nlopt::opt nm(nlopt::LN_NELDERMEAD, _nfree);
+        nm.set_lower_bounds(0.0000);
+        nm.set_upper_bounds(MAX_RATE);
+        nm.set_min_objective(nlopt_sr_periods, &data);
+        nm.set_xtol_rel(0.001);
+        nm.set_ftol_abs(0.000001);
+        nm.set_maxeval(10000);
+        result = data.best_x;
+        try {
+            nm.optimize(result, minf);
+        } catch (std::runtime_error& e) {
+            // roundoff or a failure: keep the best point either run found
         }
+        result = data.best_x;
     }
-    //double minf;
-    std::vector<double> result = opt.optimize(x);
     for (unsigned int k=0; k < _rm->size(); k++) {
         for (unsigned int i=0; i < _rm->at(k).get_Q().n_rows; i++) {
             for (unsigned int j=0; j < _rm->at(k).get_Q().n_cols; j++) {
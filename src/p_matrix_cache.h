@@ -0,0 +1,135 @@
+#ifndef _P_MATRIX_CACHE_H_
+#define _P_MATRIX_CACHE_H_
+
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <utility>
+
+
+/*
+ * what a transition matrix was made from: the revision of the rate matrix
+ * (bumped on every change to Q), the branch length and the period (or which
+ * of the model's Q's, -1 for the main one)
+ */
+struct PMatrixKey {
+    unsigned long version;
+    double bl;
+    int period;
+
+    PMatrixKey (unsigned long v, double b, int p):version(v), bl(b), period(p) {}
+
+    bool operator== (const PMatrixKey& k) const {
+        return version == k.version && bl == k.bl && period == k.period;
+    }
+};
+
+
+struct PMatrixKeyHasher {
+    size_t operator() (const PMatrixKey& k) const {
+        size_t h = std::hash<unsigned long>()(k.version);
+        h ^= std::hash<double>()(k.bl) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        h ^= std::hash<int>()(k.period) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+
+/*
+ * bounded (least recently used) cache of transition matrices, so repeated
+ * branch lengths (e.g., ultrametric trees) only need one matrix exponential
+ * per rate matrix. keeps hit/miss counts
+ */
+template<class M>
+class PMatrixCache {
+private:
+    typedef std::pair<PMatrixKey, M> Entry;
+    typedef typename std::list<Entry>::iterator EntryIter;
+
+    size_t capacity_;
+    std::list<Entry> entries_; // most recently used first
+    std::unordered_map<PMatrixKey, EntryIter, PMatrixKeyHasher> lookup_;
+    unsigned long hits_;
+    unsigned long misses_;
+
+public:
+    PMatrixCache (const size_t& capacity = 1024):capacity_(capacity), hits_(0), misses_(0) {}
+
+    PMatrixCache (const PMatrixCache& other):capacity_(other.capacity_),
+            entries_(other.entries_), hits_(other.hits_), misses_(other.misses_) {
+        for (EntryIter it = entries_.begin(); it != entries_.end(); ++it) {
+            lookup_[it->first] = it;
+        }
+    }
+
+    PMatrixCache& operator= (const PMatrixCache& other) {
+        if (this != &other) {
+            capacity_ = other.capacity_;
+            entries_ = other.entries_;
+            hits_ = other.hits_;
+            misses_ = other.misses_;
+            lookup_.clear();
+            for (EntryIter it = entries_.begin(); it != entries_.end(); ++it) {
+                lookup_[it->first] = it;
+            }
+        }
+        return *this;
+    }
+
+    // NULL on a miss. the pointer is good until the next insert
+    const M * find (const PMatrixKey& key) {
+        typename std::unordered_map<PMatrixKey, EntryIter, PMatrixKeyHasher>::iterator it = lookup_.find(key);
+        if (it == lookup_.end()) {
+            misses_++;
+            return NULL;
+        }
+        hits_++;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return &it->second->second;
+    }
+
+    void insert (const PMatrixKey& key, const M& val) {
+        if (capacity_ == 0) {
+            return;
+        }
+        typename std::unordered_map<PMatrixKey, EntryIter, PMatrixKeyHasher>::iterator it = lookup_.find(key);
+        if (it != lookup_.end()) {
+            it->second->second = val;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        entries_.push_front(Entry(key, val));
+        lookup_[key] = entries_.begin();
+        if (entries_.size() > capacity_) {
+            lookup_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    void clear () {
+        entries_.clear();
+        lookup_.clear();
+    }
+
+    void set_capacity (const size_t& capacity) {
+        capacity_ = capacity;
+        while (entries_.size() > capacity_) {
+            lookup_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    size_t size () const {
+        return entries_.size();
+    }
+
+    unsigned long get_hits () const {
+        return hits_;
+    }
+
+    unsigned long get_misses () const {
+        return misses_;
+    }
+};
+
+#endif /* _P_MATRIX_CACHE_H_ */
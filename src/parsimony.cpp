@@ -0,0 +1,221 @@
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <bitset>
+#include <iostream>
+#include <cstdlib>
+
+#include "parsimony.h"
+#include "likelihood_workspace.h"
+#include "node.h"
+
+
+FitchParsimony::FitchParsimony (const std::vector<Sequence>& seqs, const bool& is_dna):
+        patterns_(seqs, is_dna), num_states_(patterns_.get_num_states()), num_words_(0),
+        num_informative_(0), constant_cost_(0) {
+    pack_patterns();
+}
+
+
+/*
+ * a pattern only discriminates between trees if at least two states are
+ * each seen (unambiguously) in two or more taxa. otherwise it costs one step
+ * per extra state on any tree with all of the taxa. patterns with partial
+ * ambiguities are always run through the tree
+ */
+bool FitchParsimony::is_informative (const int& pattern, int& cost) const {
+    unsigned int all = patterns_.get_all_states_mask();
+    std::vector<int> counts(num_states_, 0);
+    for (int i=0; i < patterns_.get_num_taxa(); i++) {
+        unsigned int m = patterns_.get_tip_masks(i)[pattern];
+        if (m == all) {
+            continue;
+        }
+        if ((m & (m - 1)) != 0) {
+            return true;
+        }
+        for (int s=0; s < num_states_; s++) {
+            if (m == (1u << s)) {
+                counts[s]++;
+            }
+        }
+    }
+    int seen = 0;
+    int shared = 0;
+    for (int s=0; s < num_states_; s++) {
+        if (counts[s] > 0) {
+            seen++;
+        }
+        if (counts[s] > 1) {
+            shared++;
+        }
+    }
+    cost = (seen > 0) ? seen - 1 : 0;
+    return shared > 1;
+}
+
+
+/*
+ * informative patterns go into the bit planes heaviest first, so that most
+ * words hold patterns of a single weight and cost a popcount and a multiply.
+ * the padding at the end of the last word gets every state at every tip and
+ * so never costs anything
+ */
+void FitchParsimony::pack_patterns () {
+    const std::vector<int>& weights = patterns_.get_pattern_weights();
+    std::vector<int> informative;
+    for (int p=0; p < patterns_.get_num_patterns(); p++) {
+        int cost = 0;
+        if (is_informative(p, cost)) {
+            informative.push_back(p);
+        } else {
+            constant_cost_ += cost * weights[p];
+        }
+    }
+    std::stable_sort(informative.begin(), informative.end(),
+        [&weights](const int& a, const int& b) { return weights[a] > weights[b]; });
+    num_informative_ = (int)informative.size();
+    num_words_ = (num_informative_ + 63) / 64;
+
+    slot_weights_.assign((size_t)num_words_ * 64, 0);
+    word_weights_.assign(num_words_, 0);
+    for (int k=0; k < num_informative_; k++) {
+        slot_weights_[k] = weights[informative[k]];
+    }
+    for (int w=0; w < num_words_; w++) {
+        int first = slot_weights_[w * 64];
+        bool same = true;
+        for (int b=0; b < 64 && w * 64 + b < num_informative_; b++) {
+            if (slot_weights_[w * 64 + b] != first) {
+                same = false;
+                break;
+            }
+        }
+        word_weights_[w] = same ? first : 0;
+    }
+
+    tip_planes_.assign(patterns_.get_num_taxa(),
+        std::vector<uint64_t>((size_t)num_states_ * num_words_, 0));
+    for (int i=0; i < patterns_.get_num_taxa(); i++) {
+        const std::vector<unsigned int>& masks = patterns_.get_tip_masks(i);
+        for (int k=0; k < num_words_ * 64; k++) {
+            unsigned int m = (k < num_informative_) ? masks[informative[k]]
+                : patterns_.get_all_states_mask();
+            for (int s=0; s < num_states_; s++) {
+                if (m & (1u << s)) {
+                    tip_planes_[i][(size_t)s * num_words_ + k / 64] |= (uint64_t)1 << (k % 64);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * one postorder pass. each child is folded into the parent's sets a plane at
+ * a time: the intersection where it is not empty, the union (and a step)
+ * where it is. the loops over words have no dependencies between words and
+ * vectorise. children of a polytomy are folded in one after another, which
+ * scores one resolution of it
+ */
+int FitchParsimony::calc_score (Tree * tree) const {
+    int nw = num_words_;
+    int plane = num_states_ * nw;
+
+    std::vector<Node *> order;
+    std::vector<Node *> stack;
+    stack.push_back(tree->getRoot());
+    while (!stack.empty()) {
+        Node * nd = stack.back();
+        stack.pop_back();
+        order.push_back(nd);
+        for (int i=0; i < nd->getChildCount(); i++) {
+            stack.push_back(nd->getChild(i));
+        }
+    }
+    std::unordered_map<Node *, int> rows;
+    int num_tips = 0;
+    for (int i=(int)order.size()-1, r=0; i >= 0; i--) {
+        if (order[i]->getChildCount() > 0) {
+            rows[order[i]] = r++;
+        } else {
+            if (patterns_.get_taxon_index(order[i]->getName()) < 0) {
+                std::cerr << "Error: taxon '" << order[i]->getName()
+                    << "' in the tree is not in the alignment. Exiting." << std::endl;
+                exit(0);
+            }
+            num_tips++;
+        }
+    }
+    if (num_tips != patterns_.get_num_taxa()) {
+        std::cerr << "Error: the tree has " << num_tips << " tips but the alignment has "
+            << patterns_.get_num_taxa() << " taxa. Exiting." << std::endl;
+        exit(0);
+    }
+    if (rows.empty() || nw == 0) {
+        return constant_cost_;
+    }
+
+    LikelihoodWorkspace<uint64_t> sets((int)rows.size(), plane);
+    std::vector<uint64_t> any(nw);
+    int score = 0;
+    for (int i=(int)order.size()-1; i >= 0; i--) {
+        Node * nd = order[i];
+        if (nd->getChildCount() == 0) {
+            continue;
+        }
+        uint64_t * cur = sets.row(rows[nd]);
+        for (int ch=0; ch < nd->getChildCount(); ch++) {
+            Node * child = nd->getChild(ch);
+            const uint64_t * cs = (child->getChildCount() == 0)
+                ? &tip_planes_[patterns_.get_taxon_index(child->getName())][0]
+                : sets.row(rows[child]);
+            if (ch == 0) {
+                std::copy(cs, cs + plane, cur);
+                continue;
+            }
+            std::fill(any.begin(), any.end(), 0);
+            for (int s=0; s < num_states_; s++) {
+                const uint64_t * a = cur + s * nw;
+                const uint64_t * b = cs + s * nw;
+                for (int w=0; w < nw; w++) {
+                    any[w] |= a[w] & b[w];
+                }
+            }
+            for (int s=0; s < num_states_; s++) {
+                uint64_t * a = cur + s * nw;
+                const uint64_t * b = cs + s * nw;
+                for (int w=0; w < nw; w++) {
+                    a[w] = (a[w] & b[w]) | ((a[w] | b[w]) & ~any[w]);
+                }
+            }
+            for (int w=0; w < nw; w++) {
+                uint64_t miss = ~any[w];
+                if (miss == 0) {
+                    continue;
+                }
+                if (word_weights_[w] > 0) {
+                    score += word_weights_[w] * (int)std::bitset<64>(miss).count();
+                } else {
+                    for (int b=0; b < 64; b++) {
+                        if ((miss >> b) & 1) {
+                            score += slot_weights_[w * 64 + b];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return score + constant_cost_;
+}
+
+
+int FitchParsimony::get_num_patterns () const {
+    return patterns_.get_num_patterns();
+}
+
+
+int FitchParsimony::get_num_informative () const {
+    return num_informative_;
+}
@@ -0,0 +1,43 @@
+#ifndef _PARSIMONY_H_
+#define _PARSIMONY_H_
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "sequence.h"
+#include "tree.h"
+#include "site_patterns.h"
+
+
+/*
+ * fitch parsimony score of a DNA or amino acid alignment on a tree. the
+ * informative site patterns are packed into bit planes, one 64-bit word per
+ * 64 patterns per state, so a node's state sets for 64 patterns are combined
+ * with a handful of word operations. patterns that cost the same on every
+ * tree (at most one state seen more than once) are scored once up front.
+ * scoring only reads shared state, so trees can be scored from several
+ * threads at once
+ */
+class FitchParsimony {
+private:
+    SitePatterns patterns_;
+    int num_states_;
+    int num_words_; // per state plane
+    int num_informative_;
+    int constant_cost_; // of the uninformative patterns
+    std::vector<int> word_weights_; // weight of every pattern in the word, 0 if they differ
+    std::vector<int> slot_weights_; // [word * 64 + bit], 0 for padding
+    std::vector< std::vector<uint64_t> > tip_planes_; // [taxon][state * num_words_ + word]
+
+    bool is_informative (const int& pattern, int& cost) const;
+    void pack_patterns ();
+
+public:
+    FitchParsimony (const std::vector<Sequence>& seqs, const bool& is_dna);
+    int calc_score (Tree * tree) const;
+    int get_num_patterns () const;
+    int get_num_informative () const;
+};
+
+#endif /* _PARSIMONY_H_ */
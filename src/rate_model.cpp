@@ -1,6 +1,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <cmath>
+#include <algorithm>
 
 #include "rate_model.h"
 
@@ -23,7 +25,8 @@ RateModel::RateModel(int _nstates):Q(_nstates, _nstates), labels(), Q_mask(),
     lasteigval(_nstates, _nstates), lasteigvec(_nstates, _nstates),
     eigval(_nstates, _nstates), eigvec(_nstates, _nstates),
     lasteigval_simple(_nstates, _nstates), lasteigvec_simple(_nstates, _nstates),
-    eigval_simple(_nstates, _nstates), eigvec_simple(_nstates, _nstates), nstates(_nstates) {
+    eigval_simple(_nstates, _nstates), eigvec_simple(_nstates, _nstates), q_version(0),
+    p_cache(), rev_version(0), reversible(false), nstates(_nstates) {
     
     setup_Q();
     sameQ = false;
@@ -38,12 +41,42 @@ RateModel::RateModel(int _nstates):Q(_nstates, _nstates), labels(), Q_mask(),
 }
 
 
-void RateModel::set_Q_cell(int from, int to, double num) {
-    Q(from, to) = num;
+/*
+ * any change to the rate matrix makes the cached (and stored) p matrices stale
+ */
+void RateModel::Q_changed() {
     sameQ = false;
+    q_version++;
+    stored_p_matrices.clear();
+}
+
+
+/*
+ * (re)build the symmetrised eigensystem if Q has changed. false if Q is not
+ * time-reversible, in which case the general (complex) route is used
+ */
+bool RateModel::setup_reversible() {
+    if (rev_version != q_version) {
+        reversible = reversible_eigensystem(Q, rev_eigval, rev_left, rev_right);
+        rev_version = q_version;
+    }
+    return reversible;
+}
+
+/*
+ * the optimisers rewrite every cell on each evaluation, so only a cell (or,
+ * in set_Q_diag, a diagonal) that actually moves counts as a change. that
+ * keeps the versions of the period models whose rates were left alone
+*/
+void RateModel::set_Q_cell(int from, int to, double num) {
+    if (Q(from, to) != num) {
+        Q(from, to) = num;
+        Q_changed();
+    }
 }
 
 void RateModel::set_Q_diag() {
+    bool moved = false;
     for (unsigned int i=0; i < Q.n_rows; i++) {
         double su = 0;
         for (unsigned int j=0; j < Q.n_cols; j++) {
@@ -51,9 +84,14 @@ void RateModel::set_Q_diag() {
                 su += Q(i, j);
             }
         }
-        Q(i, i) = 0-su;
+        if (Q(i, i) != 0-su) {
+            Q(i, i) = 0-su;
+            moved = true;
+        }
+    }
+    if (moved == true) {
+        Q_changed();
     }
-    sameQ = false;
 }
 
 void RateModel::setup_Q() {
@@ -67,7 +105,7 @@ void RateModel::setup_Q() {
             }
         }
     }
-    sameQ = false;
+    Q_changed();
 }
 
 void RateModel::setup_Q(std::vector< std::vector<double> >& inQ) {
@@ -80,7 +118,7 @@ void RateModel::setup_Q(std::vector< std::vector<double> >& inQ) {
         colvec a = (sum(Q, 1));
         Q(i, i) = -(a(i)-Q(i, i));
     }
-    sameQ = false;
+    Q_changed();
 }
 
 void RateModel::setup_Q(mat& inQ) {
@@ -90,7 +128,7 @@ void RateModel::setup_Q(mat& inQ) {
         }
     }
     set_Q_diag();
-    sameQ = false;
+    Q_changed();
 }
 
 void RateModel::set_n_qs(int number) {
@@ -115,7 +153,7 @@ void RateModel::set_Q_which(mat& inQ, int which) {
         }
         Qs[which](i, i) = 0-su;
     }
-    sameQ = false;
+    Q_changed();
 }
 
 void RateModel::set_Q(mat& inQ) {
@@ -124,25 +162,50 @@ void RateModel::set_Q(mat& inQ) {
             Q(i, j) = inQ(i, j);
         }
     }
-    sameQ = false;
+    Q_changed();
 }
 
 mat& RateModel::get_Q() {
     return Q;
 }
 
-cx_mat RateModel::setup_P(double bl, bool store_p_matrices) {
-    //sameQ = false;
-    eigvec.fill(0);
-    eigval.fill(0);
-    get_eigenvec_eigenval_from_Q(&eigval, &eigvec); // not currently used
-    //std::cout << eigval << std::endl;
-    //std::cout << eigvec << std::endl;
-    for (int i=0; i < nstates; i++) {
-        eigval(i, i) = exp(eigval(i, i) * bl);
+/*
+ * the p matrix for the current Q over a branch (segment) of length bl. these
+ * are cached on (Q revision, bl, period) so repeated branch lengths are only
+ * exponentiated once per Q
+ */
+cx_mat RateModel::setup_P(double bl, bool store_p_matrices, int period) {
+    PMatrixKey key(q_version, bl, period);
+    const std::pair<cx_mat, bool> * cached = p_cache.find(key);
+    if (cached != NULL) {
+        neg_p = cached->second;
+        if (store_p_matrices == true) {
+            stored_p_matrices[bl] = cached->first;
+        }
+        return cached->first;
+    }
+    cx_mat P(nstates, nstates);
+    if (setup_reversible()) {
+        mat rp;
+        reversible_p_matrix(rev_eigval, rev_left, rev_right, bl, rp);
+        for (int i=0; i < nstates; i++) {
+            for (int j=0; j < nstates; j++) {
+                P(i, j) = rp(i, j);
+            }
+        }
+    } else {
+        //sameQ = false;
+        eigvec.fill(0);
+        eigval.fill(0);
+        get_eigenvec_eigenval_from_Q(&eigval, &eigvec); // not currently used
+        //std::cout << eigval << std::endl;
+        //std::cout << eigvec << std::endl;
+        for (int i=0; i < nstates; i++) {
+            eigval(i, i) = exp(eigval(i, i) * bl);
+        }
+        cx_mat C_inv = inv(eigvec);
+        P = eigvec * eigval * C_inv;
     }
-    cx_mat C_inv = inv(eigvec);
-    cx_mat P = eigvec * eigval * C_inv;
     neg_p = false;
     for (unsigned int i=0; i < P.n_rows; i++) {
         for (unsigned int j=0; j < P.n_cols; j++) {
@@ -150,6 +213,7 @@ cx_mat RateModel::setup_P(double bl, bool store_p_matrices) {
             neg_p = true;
         }
     }
+    p_cache.insert(key, std::make_pair(P, neg_p));
     if (store_p_matrices == true) {
         stored_p_matrices[bl] = P;    
     }
@@ -157,6 +221,10 @@ cx_mat RateModel::setup_P(double bl, bool store_p_matrices) {
 }
 
 void RateModel::setup_P_simple(mat& p, double bl, bool store_p_matrices) {
+    if (setup_reversible()) {
+        reversible_p_matrix(rev_eigval, rev_left, rev_right, bl, p);
+        return;
+    }
 //    sameQ = false;
     eigvec_simple.fill(0);
     eigval_simple.fill(0);
@@ -259,6 +327,34 @@ bool RateModel::get_eigenvec_eigenval_from_Q(cx_mat * eigval, cx_mat * eigvec) {
     return isImag;
 }
 
+/*
+ * the eigensystem of Q as Q = left * diag(eigval) * right (right is the
+ * inverse of left). uses the symmetrised decomposition when Q is reversible
+ */
+void RateModel::get_eigensystem(cx_vec& eigva, cx_mat& left, cx_mat& right) {
+    eigva.set_size(nstates);
+    left.set_size(nstates, nstates);
+    right.set_size(nstates, nstates);
+    if (setup_reversible()) {
+        for (int i=0; i < nstates; i++) {
+            eigva(i) = rev_eigval(i);
+            for (int j=0; j < nstates; j++) {
+                left(i, j) = rev_left(i, j);
+                right(i, j) = rev_right(i, j);
+            }
+        }
+        return;
+    }
+    cx_mat val(nstates, nstates);
+    cx_mat vec(nstates, nstates);
+    get_eigenvec_eigenval_from_Q(&val, &vec);
+    for (int i=0; i < nstates; i++) {
+        eigva(i) = val(i, i);
+    }
+    left = vec;
+    right = inv(vec);
+}
+
 //taking out fortran
 //
 /*
@@ -320,6 +416,121 @@ void RateModel::set_sameQ(bool s) {
     sameQ = s;
 }
 
+unsigned long RateModel::get_Q_version() const {
+    return q_version;
+}
+
+void RateModel::set_p_cache_size(const size_t& size) {
+    p_cache.set_capacity(size);
+}
+
+unsigned long RateModel::get_p_cache_hits() const {
+    return p_cache.get_hits();
+}
+
+unsigned long RateModel::get_p_cache_misses() const {
+    return p_cache.get_misses();
+}
+
+/*
+ * eigensystem of a time-reversible Q. with pi the stationary frequencies and
+ * D = diag(pi), S = D^1/2 Q D^-1/2 is symmetric, so a real symmetric
+ * eigensolver does. then P(t) = left * diag(exp(eigval * t)) * right, where
+ * left = D^-1/2 U and right = U' D^1/2. pi comes from detailed balance
+ * (pi_j = pi_i q_ij / q_ji) along the nonzero rates; false if Q is not
+ * reversible (or is reducible), leaving the general route to the caller
+ */
+bool reversible_eigensystem(const mat& Q, vec& eigval, mat& left, mat& right) {
+    int n = Q.n_rows;
+    std::vector<double> pi(n, 0.0);
+    std::vector<bool> seen(n, false);
+    std::vector<int> stack;
+    pi[0] = 1.0;
+    seen[0] = true;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        int i = stack.back();
+        stack.pop_back();
+        for (int j=0; j < n; j++) {
+            if (j == i || seen[j] || Q(i, j) == 0.0) {
+                continue;
+            }
+            if (Q(j, i) <= 0.0 || Q(i, j) < 0.0) {
+                return false;
+            }
+            pi[j] = pi[i] * Q(i, j) / Q(j, i);
+            seen[j] = true;
+            stack.push_back(j);
+        }
+    }
+    double tot = 0.0;
+    double maxrate = 0.0;
+    for (int i=0; i < n; i++) {
+        if (!seen[i]) {
+            return false;
+        }
+        tot += pi[i];
+        maxrate = std::max(maxrate, std::fabs(Q(i, i)));
+    }
+    for (int i=0; i < n; i++) {
+        pi[i] /= tot;
+    }
+    // the tree of rates used above fixes pi, every other pair has to agree
+    double tol = 1e-10 * (maxrate > 0.0 ? maxrate : 1.0);
+    for (int i=0; i < n; i++) {
+        for (int j=i+1; j < n; j++) {
+            if (std::fabs(pi[i] * Q(i, j) - pi[j] * Q(j, i)) > tol) {
+                return false;
+            }
+        }
+    }
+    mat S(n, n);
+    for (int i=0; i < n; i++) {
+        for (int j=0; j < n; j++) {
+            if (i == j) {
+                S(i, j) = Q(i, i);
+            } else {
+                // average the two halves so S is exactly symmetric
+                double sij = sqrt(pi[i] / pi[j]) * Q(i, j);
+                double sji = sqrt(pi[j] / pi[i]) * Q(j, i);
+                S(i, j) = 0.5 * (sij + sji);
+            }
+        }
+    }
+    mat U;
+    if (!eig_sym(eigval, U, S)) {
+        return false;
+    }
+    left.set_size(n, n);
+    right.set_size(n, n);
+    for (int i=0; i < n; i++) {
+        double sp = sqrt(pi[i]);
+        for (int k=0; k < n; k++) {
+            left(i, k) = U(i, k) / sp;
+            right(k, i) = U(i, k) * sp;
+        }
+    }
+    return true;
+}
+
+
+/*
+ * P(t) from a reversible eigensystem: a diagonal exponential and one
+ * multiply
+ */
+void reversible_p_matrix(const vec& eigval, const mat& left, const mat& right,
+        const double& t, mat& P) {
+    mat scaled = left;
+    for (unsigned int k=0; k < scaled.n_cols; k++) {
+        double e = exp(eigval(k) * t);
+        for (unsigned int i=0; i < scaled.n_rows; i++) {
+            scaled(i, k) *= e;
+        }
+    }
+    P = scaled * right;
+}
+
+
 void update_simple_goldman_yang_q(mat * inm, double K, double w, mat& bigpibf,
         mat& bigpiK, mat& bigpiw) {
     double s = 0;
@@ -407,3 +618,101 @@ void convert_matrix_to_single_row_for_fortran(mat& inmatrix, double t, double *
     }
 }
 */
+
+
+/*
+ * P(a, x), the lower incomplete gamma function over Gamma(a): series below
+ * a+1, continued fraction above
+ */
+double regularized_lower_gamma (const double& a, const double& x) {
+    if (x <= 0.0) {
+        return 0.0;
+    }
+    double lpre = -x + a * log(x) - lgamma(a);
+    if (x < a + 1.0) {
+        double ap = a;
+        double del = 1.0 / a;
+        double su = del;
+        for (int i=0; i < 1000; i++) {
+            ap += 1.0;
+            del *= x / ap;
+            su += del;
+            if (fabs(del) < fabs(su) * 1e-16) {
+                break;
+            }
+        }
+        return su * exp(lpre);
+    }
+    // modified lentz for the upper function
+    double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+    for (int i=1; i < 1000; i++) {
+        double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if (fabs(d) < tiny) {
+            d = tiny;
+        }
+        c = b + an / c;
+        if (fabs(c) < tiny) {
+            c = tiny;
+        }
+        d = 1.0 / d;
+        double del = d * c;
+        h *= del;
+        if (fabs(del - 1.0) < 1e-16) {
+            break;
+        }
+    }
+    return 1.0 - exp(lpre) * h;
+}
+
+
+// x with P(shape, rate * x) = p, by bisection
+double gamma_quantile (const double& p, const double& shape, const double& rate) {
+    double lo = 0.0;
+    double hi = shape / rate;
+    while (regularized_lower_gamma(shape, rate * hi) < p) {
+        hi *= 2.0;
+    }
+    for (int i=0; i < 200 && (hi - lo) > 1e-15 * hi; i++) {
+        double mid = 0.5 * (lo + hi);
+        if (regularized_lower_gamma(shape, rate * mid) < p) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+
+/*
+ * mean rate of each of ncats equal-probability categories of a gamma with
+ * shape alpha and mean 1 (yang 1994). the mean of the part of the
+ * distribution below x is P(alpha+1, alpha*x)
+ */
+std::vector<double> discrete_gamma_rates (const double& alpha, const int& ncats) {
+    std::vector<double> rates(ncats, 0.0);
+    double prev = 0.0;
+    for (int i=0; i < ncats; i++) {
+        double cur = 1.0;
+        if (i < ncats - 1) {
+            double cut = gamma_quantile((i + 1.0) / ncats, alpha, alpha);
+            cur = regularized_lower_gamma(alpha + 1.0, alpha * cut);
+        }
+        rates[i] = (cur - prev) * ncats;
+        prev = cur;
+    }
+    double tot = 0.0;
+    for (int i=0; i < ncats; i++) {
+        tot += rates[i];
+    }
+    for (int i=0; i < ncats; i++) {
+        rates[i] *= ncats / tot;
+    }
+    return rates;
+}
@@ -6,6 +6,8 @@
 #include <vector>
 #include <map>
 
+#include "p_matrix_cache.h"
+
 using namespace arma;
 
 class RateModel {
@@ -27,6 +29,16 @@ private:
     int fortran_iexph;
     double * fortran_wsp;
     int fortran_m;
+    unsigned long q_version; // bumped whenever Q (or one of the Qs) changes
+    PMatrixCache<std::pair<cx_mat, bool> > p_cache; // p matrix and its neg_p
+    // symmetrised eigensystem of Q when it is time-reversible
+    unsigned long rev_version; // q_version the eigensystem was made for
+    bool reversible;
+    vec rev_eigval;
+    mat rev_left;
+    mat rev_right;
+    void Q_changed();
+    bool setup_reversible();
     
 public:
     RateModel(int nstates);
@@ -49,16 +61,22 @@ public:
     void setup_Q(mat& inQ);
     mat& get_Q();
     void set_sameQ(bool);
-    cx_mat setup_P(double, bool);
+    cx_mat setup_P(double bl, bool store_p_matrices, int period=-1);
     void setup_P_simple(mat& p, double, bool);
     void setup_fortran_P_whichQ(int which, mat& P, double t);
     void setup_fortran_P(mat& P, double t, bool store_p_matrices);
+    unsigned long get_Q_version() const;
+    void set_p_cache_size(const size_t& size);
+    unsigned long get_p_cache_hits() const;
+    unsigned long get_p_cache_misses() const;
     /*
      * get things from stmap
      */
     //this should be used for getting the eigenvectors and eigenvalues
     bool get_eigenvec_eigenval_from_Q(cx_mat * eigenvalues, cx_mat * eigenvectors);
     void get_eigenvec_eigenval_from_Q_simple(mat * eigenvalues, mat * eigenvectors);
+    // Q = left * diag(eigval) * right, real when Q is reversible
+    void get_eigensystem(cx_vec& eigval, cx_mat& left, cx_mat& right);
     
 };
 void update_simple_goldman_yang_q(mat * inm, double K, double w, mat& bigpibf, mat& bigpiK, mat& bigpiw);
@@ -66,6 +84,11 @@ bool test_transition(char a, char b);
 void generate_bigpibf_K_w(mat * bf, mat * K, mat * w, std::map<std::string,
         std::string>& codon_dict, std::map<std::string, std::vector<int> >& codon_index,
         std::vector<std::string>& codon_list);
+bool reversible_eigensystem(const mat& Q, vec& eigval, mat& left, mat& right);
+void reversible_p_matrix(const vec& eigval, const mat& left, const mat& right, const double& t, mat& P);
 void convert_matrix_to_single_row_for_fortran(mat& inmatrix, double t, double * H);
+double regularized_lower_gamma (const double& a, const double& x);
+double gamma_quantile (const double& p, const double& shape, const double& rate);
+std::vector<double> discrete_gamma_rates (const double& alpha, const int& ncats);
 
 #endif /* _RATE_MODEL_H_ */
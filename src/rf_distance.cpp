@@ -0,0 +1,157 @@
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+
+#ifdef OMP
+#include <omp.h>
+#endif
+
+#include "rf_distance.h"
+#include "bipartition.h"
+#include "node.h"
+#include "tree.h"
+
+
+RFDistance::RFDistance ():table_(true) {}
+
+
+/*
+ * trees are tallied in the table (in parallel if asked) and only their split
+ * rows and taxa are kept, so the trees can be freed afterwards
+ */
+void RFDistance::add_trees (std::vector<Tree *>& trees, const int& nthreads) {
+    std::vector<std::vector<int> > splits = table_.add_trees(trees, nthreads);
+    for (unsigned int i = 0; i < trees.size(); i++) {
+        Bipartition taxa;
+        for (int j = 0; j < trees[i]->getExternalNodeCount(); j++) {
+            taxa.set(table_.get_index(trees[i]->getExternalNode(j)->getName()));
+        }
+        tree_taxa_.push_back(taxa);
+        tree_splits_.push_back(splits[i]);
+    }
+}
+
+
+int RFDistance::get_num_trees () const {
+    return (int)tree_splits_.size();
+}
+
+
+/*
+ * the side of a split that the table keys it on (the side with the lowest
+ * taxon of the tree it was found in). this is the same in every tree that
+ * has the split
+ */
+Bipartition RFDistance::get_key (const int& row) const {
+    const Bipartition& side = table_.get_bipart(row);
+    Bipartition all = side;
+    all.unite(table_.get_bipart2(row));
+    if (side.test(all.lowest())) {
+        return side;
+    }
+    return table_.get_bipart2(row);
+}
+
+
+/*
+ * the nontrivial splits of the subtree induced on the common taxa. splits
+ * that become identical (i.e., edges that are merged when the subtree is
+ * deknuckled) are only kept once
+ */
+std::vector<Bipartition> RFDistance::get_induced_splits (const int& tree,
+        const Bipartition& common) const {
+    std::vector<Bipartition> res;
+    std::unordered_set<Bipartition, BipartitionHasher> seen;
+    int low = common.lowest();
+    const std::vector<int>& rows = tree_splits_[tree];
+    for (unsigned int i = 0; i < rows.size(); i++) {
+        Bipartition key = get_key(rows[i]);
+        Bipartition a = key.intersection(common);
+        Bipartition b = tree_taxa_[tree].difference(key).intersection(common);
+        if (a.count() < 2 || b.count() < 2) {
+            continue;
+        }
+        if (!a.test(low)) {
+            a = b;
+        }
+        if (seen.insert(a).second) {
+            res.push_back(a);
+        }
+    }
+    return res;
+}
+
+
+int RFDistance::get_induced_distance (const int& i, const int& j) const {
+    Bipartition common = tree_taxa_[i].intersection(tree_taxa_[j]);
+    if (common.count() < 4) {
+        return 0; // no nontrivial splits
+    }
+    std::vector<Bipartition> si = get_induced_splits(i, common);
+    std::vector<Bipartition> sj = get_induced_splits(j, common);
+    std::unordered_set<Bipartition, BipartitionHasher> lookup(si.begin(), si.end());
+    int shared = 0;
+    for (unsigned int k = 0; k < sj.size(); k++) {
+        if (lookup.count(sj[k]) > 0) {
+            shared++;
+        }
+    }
+    return (int)(si.size() + sj.size()) - 2 * shared;
+}
+
+
+// number of splits found in only one of the two trees
+int RFDistance::get_distance (const int& i, const int& j) const {
+    if (tree_taxa_[i] != tree_taxa_[j]) {
+        return get_induced_distance(i, j);
+    }
+    const std::vector<int>& a = tree_splits_[i];
+    const std::vector<int>& b = tree_splits_[j];
+    unsigned int x = 0;
+    unsigned int y = 0;
+    int shared = 0;
+    while (x < a.size() && y < b.size()) {
+        if (a[x] < b[y]) {
+            x++;
+        } else if (b[y] < a[x]) {
+            y++;
+        } else {
+            shared++;
+            x++;
+            y++;
+        }
+    }
+    return (int)(a.size() + b.size()) - 2 * shared;
+}
+
+
+/*
+ * distances between trees [row_start, row_stop) and [col_start, col_stop).
+ * if the two ranges are the same only the upper triangle is computed. rows
+ * are spread over the threads
+ */
+std::vector<std::vector<int> > RFDistance::get_matrix (const int& row_start,
+        const int& row_stop, const int& col_start, const int& col_stop,
+        const int& nthreads) const {
+    int nrows = row_stop - row_start;
+    int ncols = col_stop - col_start;
+    bool square = (row_start == col_start && row_stop == col_stop);
+    std::vector<std::vector<int> > dists(nrows, std::vector<int>(ncols, 0));
+#ifdef OMP
+    omp_set_num_threads(std::max(1, nthreads));
+#endif
+    #pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < nrows; i++) {
+        for (int j = (square ? i + 1 : 0); j < ncols; j++) {
+            dists[i][j] = get_distance(row_start + i, col_start + j);
+        }
+    }
+    if (square) {
+        for (int i = 0; i < nrows; i++) {
+            for (int j = i + 1; j < ncols; j++) {
+                dists[j][i] = dists[i][j];
+            }
+        }
+    }
+    return dists;
+}
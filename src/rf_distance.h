@@ -0,0 +1,40 @@
+#ifndef _RF_DISTANCE_H_
+#define _RF_DISTANCE_H_
+
+#include <vector>
+
+#include "bipartition.h"
+
+class Tree; // forward declaration
+
+
+/*
+ * unrooted robinson-foulds distances between trees. the splits of all trees
+ * are hashed once into a shared (edgewise) BipartitionTable, so each tree
+ * becomes a sorted list of split rows and the distance between two trees
+ * with the same taxa is a merge of two integer lists. trees with different
+ * taxa are compared on the splits of their induced subtrees on the shared
+ * taxa, which are the splits of the full trees restricted to those taxa
+ */
+class RFDistance {
+private:
+    BipartitionTable table_;
+    std::vector<std::vector<int> > tree_splits_; // sorted split rows of each tree
+    std::vector<Bipartition> tree_taxa_;
+
+    Bipartition get_key (const int& row) const;
+    std::vector<Bipartition> get_induced_splits (const int& tree,
+        const Bipartition& common) const;
+    int get_induced_distance (const int& i, const int& j) const;
+
+public:
+    RFDistance ();
+
+    void add_trees (std::vector<Tree *>& trees, const int& nthreads);
+    int get_num_trees () const;
+    int get_distance (const int& i, const int& j) const;
+    std::vector<std::vector<int> > get_matrix (const int& row_start, const int& row_stop,
+        const int& col_start, const int& col_stop, const int& nthreads) const;
+};
+
+#endif /* _RF_DISTANCE_H_ */
@@ -8,7 +8,6 @@
 #include <numeric>
 
 //using namespace arma; // do we want this?
-using arma::randn;
 using arma::mat;
 using arma::expmat;
 
@@ -18,6 +17,7 @@ using arma::expmat;
 #include "tree.h"
 #include "tree_reader.h"
 #include "tree_utils.h"
+#include "rate_model.h"
 
 
 // TODO: do we want this order?
@@ -78,13 +78,20 @@ string SequenceGenerator::nucleotides = "ATCG";
  
 SequenceGenerator::SequenceGenerator (const int&seqlength, const std::vector<double>& basefreq,
     std::vector< std::vector<double> >& rmatrix, Tree * tree, const bool& showancs, 
-    const int& nreps, const int& seed, const float& alpha, const float& pinvar,
-    const std::string& ancseq, const bool& printpost, const std::vector<double>& multirates,
-    const std::vector<double>& aabasefreq, const bool& is_dna):tree_(tree),
-    seqlen_(seqlength), nreps_(nreps), seed_(seed), alpha_(alpha), pinvar_(pinvar),
+    const int& tree_number, const int& replicate, const int& seed, const float& alpha, const int& ncats,
+    const float& pinvar, const std::string& ancseq, const bool& printpost,
+    const std::vector<double>& multirates, const std::vector<double>& aabasefreq,
+    const bool& is_dna, const SeqGenModel * model):tree_(tree), seqlen_(seqlength),
+    tree_number_(tree_number), replicate_(replicate), seed_(seed),
+    alpha_(alpha), ncats_(ncats), pinvar_(pinvar),
     root_sequence_(ancseq), base_freqs_(basefreq), aa_freqs_(aabasefreq), rmatrix_(rmatrix), 
     multi_rates_(multirates), show_ancs_(showancs), print_node_labels_(printpost),
-    multi_model_(false), is_dna_(is_dna)  {
+    multi_model_(false), is_dna_(is_dna) {
+    if (model != NULL) {
+        eigen_ = *model;
+    } else {
+        eigen_.reversible = false;
+    }
     /*
      for (unsigned int i = 0; i < rmatrix.size(); i++) {
         for (unsigned int j = 0; j < rmatrix.size(); j++) {
@@ -92,15 +99,15 @@ SequenceGenerator::SequenceGenerator (const int&seqlength, const std::vector<dou
         }
         std::cout << "\n";
     }*/
-    initialize();
     if (is_dna_) {
         nstates_ = 4;
     } else {
         nstates_ = 20;
     }
+    initialize();
     // Print out the nodes names
     if (print_node_labels_) {
-        label_internal_nodes();
+        label_internal_nodes(tree_);
         print_node_labels();
         exit(0);
     }
@@ -110,9 +117,17 @@ SequenceGenerator::SequenceGenerator (const int&seqlength, const std::vector<dou
 
 // set all values
 void SequenceGenerator::initialize () {
-    // set the number generator being used
+    // set the number generator being used. every simulation other than the
+    // first replicate of the first tree gets its own stream from the seed, the
+    // tree and the replicate, so its sequences do not depend on which thread
+    // made them, when, or how many other trees and replicates there are
     if (seed_ != -1) { // user provided seed
-        generator_ = std::mt19937(seed_);
+        if (tree_number_ == 0 && replicate_ == 0) {
+            generator_ = std::mt19937(seed_);
+        } else {
+            std::seed_seq sseq{seed_, tree_number_, replicate_};
+            generator_ = std::mt19937(sseq);
+        }
     } else {
         generator_ = std::mt19937(get_clock_seed());
     }
@@ -126,18 +141,21 @@ void SequenceGenerator::initialize () {
         gammaDistrib_ = std::gamma_distribution<float>(alpha_, (1/alpha_));
     }
     
-    if (show_ancs_) {
-        label_internal_nodes();
+    // the caller may have labelled the (shared) tree already
+    if (show_ancs_ && tree_->getRoot()->getName() != "Node_0") {
+        label_internal_nodes(tree_);
     }
     if (root_sequence_.length() == 0) {
-        root_sequence_ = generate_random_sequence();
+        root_states_ = generate_random_sequence();
     } else {
         check_valid_sequence();
         // if root sequence is provided, set length to this
         seqlen_ = root_sequence_.size();
+        root_states_ = sequence_to_states(root_sequence_);
     }
     // set site-specific rate (pinvar and gamma)
     site_rates_ = set_site_rates();
+    set_rate_classes();
     
     if (multi_rates_.size() != 0) {
         multi_model_ = true;
@@ -146,39 +164,41 @@ void SequenceGenerator::initialize () {
 
 
 /* Use the P matrix probabilities and randomly draw numbers to see
- * if each individual state will undergo some type of change
+ * if each individual state will undergo some type of change.
+ * when sites share a few rates (no gamma, pinvar, discrete gamma) an alias
+ * table of every P matrix row for each rate is made once for the branch, and
+ * every site is then a single lookup. a continuous gamma gives every site its
+ * own rate and so its own P matrix
  */
-std::string SequenceGenerator::simulate_sequence (const std::string& anc, 
-    std::vector< std::vector<double> >& QMatrix, const float& brlength) {
-    std::vector<double>::iterator low;
-    std::vector< std::vector<double> > PMatrix(nstates_, std::vector<double>(nstates_, 0.0));
-    //int ancChar = 0;
-    std::string newstring = anc; // instead of building, set size and replace
-    for (int i = 0; i < seqlen_; i++) {
-        float RandNumb = get_uniform_random_deviate();
-        int ancChar = 0;
-        if (is_dna_) {
-            ancChar = nuc_map_[anc[i]];
-        } else {
-            ancChar = aa_map_[anc[i]];
-            //std::cout << ancChar << std::endl;
+void SequenceGenerator::simulate_sequence (const uint8_t * anc, uint8_t * dec,
+    const std::vector< std::vector<double> >& QMatrix, const float& brlength) {
+    int nclasses = (int)class_rates_.size();
+    bool tabled = nclasses < seqlen_;
+    if (tabled) {
+        if (branch_alias_.get_num_rows() != nclasses * nstates_) {
+            branch_alias_.resize(nclasses * nstates_, nstates_);
         }
-        float brnew = brlength * site_rates_[i];
-        PMatrix = calculate_p_matrix(QMatrix, brnew);
-        for (int i = 0; i < nstates_; i++) {
-            // this calculates a cumulative sum
-            std::partial_sum(PMatrix[i].begin(), PMatrix[i].end(), PMatrix[i].begin(), std::plus<double>());
+        for (int c = 0; c < nclasses; c++) {
+            float brnew = brlength * class_rates_[c];
+            std::vector< std::vector<double> > PMatrix = calculate_p_matrix(QMatrix, brnew);
+            for (int j = 0; j < nstates_; j++) {
+                branch_alias_.set_row(c * nstates_ + j, &PMatrix[j][0]);
+            }
         }
-        low = std::lower_bound (PMatrix[ancChar].begin(), PMatrix[ancChar].end(), RandNumb);
-        
-        if (is_dna_) {
-            newstring[i] = nucleotides_[low - PMatrix[ancChar].begin()];
+    } else if (site_alias_.get_num_rows() != 1) {
+        site_alias_.resize(1, nstates_);
+    }
+    for (int i = 0; i < seqlen_; i++) {
+        double RandNumb = get_uniform_random_deviate();
+        if (tabled) {
+            dec[i] = (uint8_t)branch_alias_.draw(site_classes_[i] * nstates_ + anc[i], RandNumb);
         } else {
-            newstring[i] = amino_acids_[low - PMatrix[ancChar].begin()];    
+            float brnew = brlength * site_rates_[i];
+            std::vector< std::vector<double> > PMatrix = calculate_p_matrix(QMatrix, brnew);
+            site_alias_.set_row(0, &PMatrix[anc[i]][0]);
+            dec[i] = (uint8_t)site_alias_.draw(0, RandNumb);
         }
     }
-    //std::cout << newstring << std::endl;
-    return newstring;
 }
 
 
@@ -186,69 +206,39 @@ std::string SequenceGenerator::simulate_sequence (const std::string& anc,
  * Calculate the Q Matrix (Substitution rate matrix)
  */
 std::vector< std::vector<double> > SequenceGenerator::calculate_q_matrix () {
-    std::vector< std::vector<double> > bigpi(nstates_, std::vector<double>(nstates_, 1.0));
-    std::vector< std::vector<double> > t(nstates_, std::vector<double>(nstates_, 0.0));
-    
-    double tscale = 0.0;
-    
-    // doing the same looping multiple times here. simplify?
-    for (unsigned int i = 0; i < rmatrix_.size(); i++) {
-        for (unsigned int j = 0; j < rmatrix_.size(); j++) {
-            if (i != j) {
-                if (is_dna_) {
-                    bigpi[i][j] *= base_freqs_[i] * base_freqs_[j] * rmatrix_[i][j];
-                } else {
-                    bigpi[i][j] *= aa_freqs_[i] * aa_freqs_[j] * rmatrix_[i][j];    
-                }
-                tscale += bigpi[i][j];
-            } else {
-                bigpi[i][j] = 0.0;
-            }
-        }
-    }
-    for (unsigned int i = 0; i < rmatrix_.size(); i++) {
-        for (unsigned int j = 0; j < rmatrix_.size(); j++) {
-            if (i != j) {
-                bigpi[i][j] /= tscale;
-            } else {
-                // set the diagnols to zero *** are they not set to zero above?
-                bigpi[i][j] = 0.0;
-            }
-        }
-    }
-    for (unsigned int i = 0; i < rmatrix_.size(); i++) {
-        double diag = 0.0;
-        for (unsigned int j = 0; j < rmatrix_.size(); j++) {
-            if (i != j) {
-                diag -= bigpi[i][j];
-            }
-        }
-        bigpi[i][i] = diag;
-    }
-    //Divide and Transpose
-    for (unsigned int i = 0; i < rmatrix_.size(); i++) {
-        for (unsigned int j = 0; j < rmatrix_.size(); j++) {
-            if (is_dna_) {
-                bigpi[i][j] /= base_freqs_[i];
-            } else {
-                bigpi[i][j] /= aa_freqs_[i];
-            }
-        }
+    if (is_dna_) {
+        return build_q_matrix(rmatrix_, base_freqs_);
+    } else {
+        return build_q_matrix(rmatrix_, aa_freqs_);
     }
-    return bigpi;
 }
 
 
 /* Calculate the P Matrix (Probability Matrix)
  * Changes to armadillos format then back I don't like the way could be more
  * efficient but yeah...
+ * Reversible Q's (the usual case) are decomposed once and then each P is
+ * just a diagonal exponential and a multiply; otherwise use expmat
  */
 std::vector< std::vector<double> > SequenceGenerator::calculate_p_matrix (const std::vector< std::vector<double> >& QMatrix,
     float br) {
 
     std::vector< std::vector<double> > Pmatrix(nstates_, std::vector<double>(nstates_, 0.0));
-    mat A = randn<mat>(nstates_, nstates_);
-    mat B = randn<mat>(nstates_, nstates_); // why not just copy A?
+    if (QMatrix != eigen_.q) {
+        eigen_ = build_seqgen_model(QMatrix);
+    }
+    if (eigen_.reversible) {
+        mat P;
+        reversible_p_matrix(eigen_.eigval, eigen_.left, eigen_.right, br, P);
+        for (int i = 0; i < nstates_; i++) {
+            for (int j = 0; j < nstates_; j++) {
+                Pmatrix[i][j] = P(i, j);
+            }
+        }
+        return Pmatrix;
+    }
+    mat A(nstates_, nstates_);
+    mat B;
     int count = 0;
     //Q * t moved into Matrix form for armadillo
     for (unsigned int i = 0; i < QMatrix.size(); i++) {
@@ -309,28 +299,33 @@ void SequenceGenerator::preorder_tree_traversal () {
         //QMatrix = calculate_q_matrix();
     }
     QMatrix = calculate_q_matrix();
+    qs_.push_back(QMatrix);
+    
+    // nodes are numbered by their place in the tree's (postorder) node list,
+    // so the root is last and is done first
+    int nnodes = tree_->getNodeCount();
+    std::map<Node *, int> node_index;
+    std::vector<int> pending(nnodes, 0); // children still to simulate
+    for (int k = 0; k < nnodes; k++) {
+        node_index[tree_->getNode(k)] = k;
+        pending[k] = tree_->getNode(k)->getChildCount();
+    }
+    std::vector<int> node_q(nnodes, 0);
+    std::vector<int> node_buffer(nnodes, -1);
+    
     Node * root = tree_->getRoot();
-    seqs_[root] = root_sequence_;
-    ancq_[root] = QMatrix;
+    node_buffer[nnodes - 1] = acquire_buffer();
+    buffers_[node_buffer[nnodes - 1]] = root_states_;
     
     if (show_ancs_) {
         std::string tname = root->getName();
-        Sequence seq(tname, root_sequence_);
+        Sequence seq(tname, states_to_sequence(root_states_));
         res.push_back(seq);
     }
     
     // Pre-Order Traverse the tree
-    for (int k = (tree_->getNodeCount() - 2); k >= 0; k--) {
+    for (int k = (nnodes - 2); k >= 0; k--) {
         brlength = tree_->getNode(k)->getBL();
-        /*
-        for (unsigned int i = 0; i < QMatrix.size(); i++) {
-            for (unsigned int j = 0; j < QMatrix.size(); j++) {
-                std::cout << QMatrix[i][j] << " ";
-            }
-            std::cout << "\n";
-        }
-        std::cout << "\n";
-        */
         if (multi_model_) {
             check = (int)round(multi_rates_[0]);
             //std::cout << check << " " << rate_count << std::endl;
@@ -356,47 +351,47 @@ void SequenceGenerator::preorder_tree_traversal () {
                     for (unsigned int i = 0; i < 7; i++) {
                         multi_rates_.erase(multi_rates_.begin() + 0);
                     }
-                    //std::cout << "Size " << multi_rates_.size() << std::endl;
-                    //std::cout << multi_rates_[0] << std::endl;
-                    /*
-                    for (unsigned int i = 0; i < multi_rates_.size(); i++) {
-                        std::cout << multi_rates_[i] << std::endl;
-                    }*/        
+                    qs_.push_back(calculate_q_matrix());
                 }
                 rate_count++;
             }
         }
-        QMatrix = calculate_q_matrix();
-        //PMatrix = calculate_p_matrix(QMatrix, brlength);
         Node * dec = tree_->getNode(k);
-        Node * parent = tree_->getNode(k)->getParent();
-        //ancq[dec] = QMatrix;
-        std::vector< std::vector<double> > Qparent = ancq_[parent];
-        std::string ancSeq = seqs_[parent];
-        std::string decSeq = simulate_sequence(ancSeq, Qparent, brlength);
-        /*
-        for (unsigned int i = 0; i < Qparent.size(); i++) {
-            for (unsigned int j = 0; j < Qparent.size(); j++) {
-                std::cout << Qparent[i][j] << " ";
-            }
-            std::cout << "\n";
-        }
-        std::cout << "\n";*/
+        int parent = node_index[dec->getParent()];
+        // the model in force below this node (used by its children)
+        node_q[k] = (int)qs_.size() - 1;
+        node_buffer[k] = acquire_buffer();
+        simulate_sequence(&buffers_[node_buffer[parent]][0], &buffers_[node_buffer[k]][0],
+            qs_[node_q[parent]], brlength);
         
-        seqs_[dec] = decSeq;
-        ancq_[dec] = QMatrix; // why store this?
-        if (show_ancs_ && tree_->getNode(k)->isInternal() == true) {
-            std::string tname = tree_->getNode(k)->getName();
-            Sequence seq(tname, decSeq);
+        if (show_ancs_ && dec->isInternal() == true) {
+            std::string tname = dec->getName();
+            Sequence seq(tname, states_to_sequence(buffers_[node_buffer[k]]));
             res.push_back(seq);
         }
         // If its a tip print the name and the sequence
-        if (tree_->getNode(k)->isInternal() != true) {
-            std::string tname = tree_->getNode(k)->getName();
-            Sequence seq(tname, decSeq);
+        if (dec->isInternal() != true) {
+            std::string tname = dec->getName();
+            Sequence seq(tname, states_to_sequence(buffers_[node_buffer[k]]));
             res.push_back(seq);
+            free_buffers_.push_back(node_buffer[k]);
         }
+        if (--pending[parent] == 0) {
+            free_buffers_.push_back(node_buffer[parent]);
+        }
+    }
+}
+
+
+// a state array of seqlen_ sites, reusing one that is no longer needed
+int SequenceGenerator::acquire_buffer () {
+    if (!free_buffers_.empty()) {
+        int b = free_buffers_.back();
+        free_buffers_.pop_back();
+        return b;
     }
+    buffers_.push_back(std::vector<uint8_t>(seqlen_));
+    return (int)buffers_.size() - 1;
 }
 
 
@@ -407,18 +402,18 @@ void SequenceGenerator::print_node_labels() {
 }
 
 
-void SequenceGenerator::label_internal_nodes() {
+void SequenceGenerator::label_internal_nodes (Tree * tree) {
     int count = 1;
     std::string str = "Node";
     std::string nlabel = "";
-    Node * root = tree_->getRoot();
+    Node * root = tree->getRoot();
     root->setName("Node_0");
-    for (int k = (tree_->getNodeCount() - 2); k >= 0; k--) {
-        if (tree_->getNode(k)->isInternal() == true) {
+    for (int k = (tree->getNodeCount() - 2); k >= 0; k--) {
+        if (tree->getNode(k)->isInternal() == true) {
             //std::cout << k << std::endl;
             str = std::to_string(count);
             nlabel = "Node_" + str;
-            tree_->getNode(k)->setName(nlabel);
+            tree->getNode(k)->setName(nlabel);
             count++;
         }
     }
@@ -431,60 +426,103 @@ std::vector<float> SequenceGenerator::set_site_rates () {
     // invariable sites
     if (pinvar_ != 0.0) {
         int numsample = seqlen_ * pinvar_ + 0.5;
-        // sample invariable sites
-        std::vector<int> randsites = sample_without_replacement(seqlen_, numsample);
-        // must be a more elegant way of doing this
+        // sample invariable sites (partial shuffle) from this replicate's stream
+        std::vector<int> allsites(seqlen_);
+        std::iota(allsites.begin(), allsites.end(), 0);
         for (int i = 0; i < numsample; i++) {
-            srates[randsites[i]] = 0.0;
+            std::uniform_int_distribution<int> pick(i, seqlen_ - 1);
+            std::swap(allsites[i], allsites[pick(generator_)]);
+            srates[allsites[i]] = 0.0;
         }
     }
     
     // gamma-distributed rate variation. could explore other distributions...
     if (alpha_ != -1.0) { // default i.e. no rate variation
-        for (int i = 0; i < seqlen_; i++) {
-            // want to skip over sites that are set to invariable
-            if (srates[i] != 0.0) {
-                srates[i] = get_gamma_random_deviate(alpha_);
+        if (ncats_ > 0) {
+            // each site falls in one of ncats_ equally probable categories
+            std::vector<double> crates = discrete_gamma_rates(alpha_, ncats_);
+            for (int i = 0; i < seqlen_; i++) {
+                if (srates[i] != 0.0) {
+                    int cat = (int)(get_uniform_random_deviate() * ncats_);
+                    if (cat >= ncats_) {
+                        cat = ncats_ - 1;
+                    }
+                    srates[i] = crates[cat];
+                }
+            }
+        } else {
+            for (int i = 0; i < seqlen_; i++) {
+                // want to skip over sites that are set to invariable
+                if (srates[i] != 0.0) {
+                    srates[i] = get_gamma_random_deviate(alpha_);
+                }
             }
         }
     }
     return srates;
-} 
+}
 
 
-// initialized as string of length seqlength, all 'G'
-std::string SequenceGenerator::generate_random_sequence () {
-    std::string ancseq(seqlen_, 'G');
-    if (is_dna_) {
-        //string ancseq(seqlen, 'G');
-        std::vector<double> cumsum(4);
-        std::vector<double>::iterator low;
-        // cumulative sum
-        std::partial_sum(base_freqs_.begin(), base_freqs_.end(), cumsum.begin(), std::plus<double>());
-    
-        for (int i = 0; i < seqlen_; i++) {
-            float RandNumb = get_uniform_random_deviate();
-            low = std::lower_bound (cumsum.begin(), cumsum.end(), RandNumb);
-            ancseq[i] = nucleotides_[low - cumsum.begin()];
+// group the sites by rate, so each branch needs one P matrix per distinct rate
+void SequenceGenerator::set_rate_classes () {
+    std::map<float, int> seen;
+    class_rates_.clear();
+    site_classes_.resize(seqlen_);
+    for (int i = 0; i < seqlen_; i++) {
+        std::map<float, int>::iterator it = seen.find(site_rates_[i]);
+        if (it == seen.end()) {
+            int c = (int)class_rates_.size();
+            seen[site_rates_[i]] = c;
+            class_rates_.push_back(site_rates_[i]);
+            site_classes_[i] = c;
+        } else {
+            site_classes_[i] = it->second;
         }
+    }
+}
+
+
+// draws each site from the base (or AA) frequencies
+std::vector<uint8_t> SequenceGenerator::generate_random_sequence () {
+    std::vector<uint8_t> ancseq(seqlen_, 0);
+    AliasTable freqs(1, nstates_);
+    if (is_dna_) {
+        freqs.set_row(0, &base_freqs_[0]);
     } else {
-        //string ancseq(seqlen, 'G');
-        std::vector<double> cumsum(20);
-        std::vector<double>::iterator low;
-        // cumulative sum
-        std::partial_sum(aa_freqs_.begin(), aa_freqs_.end(), cumsum.begin(), std::plus<double>());
-    
-        for (int i = 0; i < seqlen_; i++) {
-            float RandNumb = get_uniform_random_deviate();
-            low = std::lower_bound (cumsum.begin(), cumsum.end(), RandNumb);
-            ancseq[i] = amino_acids_[low - cumsum.begin()];
-        }    
+        freqs.set_row(0, &aa_freqs_[0]);
+    }
+    for (int i = 0; i < seqlen_; i++) {
+        double RandNumb = get_uniform_random_deviate();
+        ancseq[i] = (uint8_t)freqs.draw(0, RandNumb);
     }
-    //std::cout << ancseq << std::endl;
     return ancseq;
 }
 
 
+// sequence must already be checked (check_valid_sequence)
+std::vector<uint8_t> SequenceGenerator::sequence_to_states (const std::string& seq) const {
+    std::vector<uint8_t> states(seq.size(), 0);
+    for (unsigned int i = 0; i < seq.size(); i++) {
+        if (is_dna_) {
+            states[i] = (uint8_t)nuc_map_.at(seq[i]);
+        } else {
+            states[i] = (uint8_t)aa_map_.at(seq[i]);
+        }
+    }
+    return states;
+}
+
+
+std::string SequenceGenerator::states_to_sequence (const std::vector<uint8_t>& states) const {
+    const std::string& alphabet = is_dna_ ? nucleotides_ : amino_acids_;
+    std::string seq(states.size(), ' ');
+    for (unsigned int i = 0; i < states.size(); i++) {
+        seq[i] = alphabet[states[i]];
+    }
+    return seq;
+}
+
+
 // rates are in order: A<->C,A<->G,A<->T,C<->G,C<->T,G<->T
 std::vector< std::vector<double> > SequenceGenerator::construct_rate_matrix (const std::vector<double>& rates) {
     // initialize
@@ -557,6 +595,73 @@ float SequenceGenerator::get_gamma_random_deviate (float alpha) {
     return gammaDistrib_(generator_);
 }
 
+
+/*
+ * the Q Matrix (Substitution rate matrix) from the exchangeabilities and
+ * state frequencies, scaled to one substitution per unit time
+ */
+std::vector< std::vector<double> > build_q_matrix (const std::vector< std::vector<double> >& rmatrix,
+    const std::vector<double>& freqs) {
+    std::vector< std::vector<double> > bigpi(rmatrix.size(), std::vector<double>(rmatrix.size(), 1.0));
+    
+    double tscale = 0.0;
+    
+    // doing the same looping multiple times here. simplify?
+    for (unsigned int i = 0; i < rmatrix.size(); i++) {
+        for (unsigned int j = 0; j < rmatrix.size(); j++) {
+            if (i != j) {
+                bigpi[i][j] *= freqs[i] * freqs[j] * rmatrix[i][j];
+                tscale += bigpi[i][j];
+            } else {
+                bigpi[i][j] = 0.0;
+            }
+        }
+    }
+    for (unsigned int i = 0; i < rmatrix.size(); i++) {
+        for (unsigned int j = 0; j < rmatrix.size(); j++) {
+            if (i != j) {
+                bigpi[i][j] /= tscale;
+            } else {
+                // set the diagnols to zero *** are they not set to zero above?
+                bigpi[i][j] = 0.0;
+            }
+        }
+    }
+    for (unsigned int i = 0; i < rmatrix.size(); i++) {
+        double diag = 0.0;
+        for (unsigned int j = 0; j < rmatrix.size(); j++) {
+            if (i != j) {
+                diag -= bigpi[i][j];
+            }
+        }
+        bigpi[i][i] = diag;
+    }
+    //Divide and Transpose
+    for (unsigned int i = 0; i < rmatrix.size(); i++) {
+        for (unsigned int j = 0; j < rmatrix.size(); j++) {
+            bigpi[i][j] /= freqs[i];
+        }
+    }
+    return bigpi;
+}
+
+
+// Q and, if it is reversible, its eigensystem
+SeqGenModel build_seqgen_model (const std::vector< std::vector<double> >& QMatrix) {
+    SeqGenModel model;
+    model.q = QMatrix;
+    int n = (int)QMatrix.size();
+    mat Q(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            Q(i, j) = QMatrix[i][j];
+        }
+    }
+    model.reversible = reversible_eigensystem(Q, model.eigval, model.left, model.right);
+    return model;
+}
+
+
 //SEQGEN::~SEQGEN() {
 //    // TODO Auto-generated destructor stub
 //}
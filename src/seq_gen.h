@@ -5,12 +5,29 @@
 #include <vector>
 #include <map>
 #include <random>
+#include <stdint.h>
+#include <armadillo>
 
 #include "sequence.h"
+#include "alias_table.h"
 
 class Tree; // forward declaration
 class Node; // forward declaration
 
+/*
+ * a rate matrix and, when it is time-reversible, its symmetrised
+ * eigensystem (so each P matrix is a diagonal exponential and a multiply).
+ * a run builds one for its model and shares it, read-only, among all of its
+ * trees and replicates
+ */
+struct SeqGenModel {
+    std::vector< std::vector<double> > q;
+    bool reversible;
+    arma::vec eigval;
+    arma::mat left;
+    arma::mat right;
+};
+
 class SequenceGenerator {
 
 private:
@@ -18,11 +35,13 @@ private:
     Tree * tree_;
     
     int seqlen_;
-    int nreps_;
+    int tree_number_; // which tree of the file, and
+    int replicate_; // which replicate this is; the two pick the random number stream
     int seed_;
     int nstates_; // number of character states
     
     float alpha_;
+    int ncats_; // discrete gamma categories, 0 for a continuous gamma
     float pinvar_;
     
     std::string root_sequence_;
@@ -32,12 +51,17 @@ private:
     std::vector< std::vector<double> > rmatrix_;
     std::vector<double> multi_rates_;
     std::vector<float> site_rates_;
+    std::vector<float> class_rates_; // distinct values of site_rates_
+    std::vector<int> site_classes_; // which of class_rates_ each site has
     
     bool show_ancs_;
     bool print_node_labels_;
     bool multi_model_;
     bool is_dna_;
     
+    // the last Q seen (to start with, that of the shared model)
+    SeqGenModel eigen_;
+    
     // hard-coded stuff
     static std::map<char, int> nuc_map_;
     static std::map<char, int> aa_map_;
@@ -51,40 +75,57 @@ private:
     // set all values
     void initialize();
     
-    // intermediate results
-    std::map<Node *, std::string> seqs_;
-    std::map<Node *, std::vector< std::vector<double> > > ancq_;
+    // intermediate results. states are indices into nucleotides_/amino_acids_
+    // and only become characters on output. a node's states are kept (in a
+    // reused buffer) until all of its children have been simulated
+    std::vector<uint8_t> root_states_;
+    std::vector< std::vector<uint8_t> > buffers_;
+    std::vector<int> free_buffers_;
+    std::vector< std::vector< std::vector<double> > > qs_; // each distinct Q in use
+    AliasTable branch_alias_; // [rate class * nstates_ + from state], current branch
+    AliasTable site_alias_; // one row, for rates that only one site has
     
     // the result to return
     std::vector<Sequence> res;
     
     // los funciones
     void print_node_labels ();
-    void label_internal_nodes ();
     void preorder_tree_traversal ();
     //std::vector<float> site_rates;
     std::vector< std::vector<double> > calculate_q_matrix ();
     std::vector< std::vector<double> > calcQmatrix (std::vector< std::vector<double> >);
     std::vector< std::vector<double> > calculate_p_matrix (const std::vector< std::vector<double> >& QMatrix,
         float br);
-    std::string simulate_sequence (const std::string& anc, std::vector< std::vector<double> >& Matrix,
-        const float& brlength);
-    std::string generate_random_sequence ();
+    void simulate_sequence (const uint8_t * anc, uint8_t * dec,
+        const std::vector< std::vector<double> >& QMatrix, const float& brlength);
+    std::vector<uint8_t> generate_random_sequence ();
+    std::vector<uint8_t> sequence_to_states (const std::string& seq) const;
+    std::string states_to_sequence (const std::vector<uint8_t>& states) const;
+    int acquire_buffer ();
     std::vector< std::vector<double> > construct_rate_matrix (const std::vector<double>& rates);
     void check_valid_sequence ();
     float get_uniform_random_deviate ();
     float get_gamma_random_deviate (float);
     std::vector<float> set_site_rates ();
+    void set_rate_classes ();
     
 public:
     SequenceGenerator (const int&seqlength, const std::vector<double>& basefreq,
         std::vector< std::vector<double> >& rmatrix, Tree * tree, const bool& showancs, 
-        const int& nreps, const int& seed, const float& alpha, const float& pinvar,
-        const std::string& ancseq, const bool& printpost, const std::vector<double>& multirates,
-        const std::vector<double>& aabasefreq, const bool& is_dna);
+        const int& tree_number, const int& replicate, const int& seed, const float& alpha, const int& ncats,
+        const float& pinvar, const std::string& ancseq, const bool& printpost, const std::vector<double>& multirates,
+        const std::vector<double>& aabasefreq, const bool& is_dna,
+        const SeqGenModel * model = NULL);
     
     // return results
     std::vector<Sequence> get_sequences ();
+    
+    // names internal nodes Node_0 (root), Node_1... in the order they are simulated
+    static void label_internal_nodes (Tree * tree);
 };
 
+std::vector< std::vector<double> > build_q_matrix (const std::vector< std::vector<double> >& rmatrix,
+    const std::vector<double>& freqs);
+SeqGenModel build_seqgen_model (const std::vector< std::vector<double> >& QMatrix);
+
 #endif /* _SEQ_GEN_H_ */
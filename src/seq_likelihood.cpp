@@ -0,0 +1,281 @@
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+#include "seq_likelihood.h"
+#include "likelihood_workspace.h"
+#include "utils.h"
+#include "node.h"
+
+
+// partials are rescaled by 2^SCALE_EXP once they drop below 2^-SCALE_EXP
+#define SCALE_EXP 256
+
+SeqLikelihood::SeqLikelihood (const std::vector<Sequence>& seqs, const bool& is_dna,
+        const std::vector<double>& freqs, const std::vector<double>& exchangeabilities,
+        const double& alpha, const int& ncats):patterns_(seqs, is_dna),
+        num_states_(patterns_.get_num_states()), num_patterns_(patterns_.get_num_patterns()),
+        num_cats_(ncats), alpha_(alpha), freqs_(freqs), rm_(is_dna ? 4 : 20) {
+    if ((int)freqs_.size() != num_states_) {
+        std::cerr << "Error: expecting " << num_states_ << " state frequencies ("
+            << freqs_.size() << " provided). Exiting." << std::endl;
+        exit(0);
+    }
+    for (int i=0; i < num_states_; i++) {
+        if (freqs_[i] <= 0.0) {
+            std::cerr << "Error: state frequencies must be positive. Exiting." << std::endl;
+            exit(0);
+        }
+    }
+    if (num_cats_ < 1) {
+        std::cerr << "Error: need at least one rate category. Exiting." << std::endl;
+        exit(0);
+    }
+    setup_model(exchangeabilities);
+    setup_rate_categories();
+}
+
+
+/*
+ * q_ij = r_ij * pi_j with the exchangeabilities r given as the upper triangle
+ * by rows (for DNA: A<->C, A<->G, A<->T, C<->G, C<->T, G<->T), scaled to one
+ * expected substitution per unit time. the rate matrix lives in the
+ * RateModel; its eigensystem is taken once here and shared by all trees
+ */
+void SeqLikelihood::setup_model (const std::vector<double>& exchangeabilities) {
+    int nex = num_states_ * (num_states_ - 1) / 2;
+    if ((int)exchangeabilities.size() != nex) {
+        std::cerr << "Error: expecting " << nex << " substitution parameters ("
+            << exchangeabilities.size() << " provided). Exiting." << std::endl;
+        exit(0);
+    }
+    mat Q(num_states_, num_states_);
+    Q.fill(0);
+    int k = 0;
+    for (int i=0; i < num_states_; i++) {
+        for (int j=i+1; j < num_states_; j++) {
+            if (exchangeabilities[k] <= 0.0) {
+                std::cerr << "Error: substitution parameters must be positive. Exiting." << std::endl;
+                exit(0);
+            }
+            Q(i, j) = exchangeabilities[k] * freqs_[j];
+            Q(j, i) = exchangeabilities[k] * freqs_[i];
+            k++;
+        }
+    }
+    double mu = 0.0;
+    for (int i=0; i < num_states_; i++) {
+        double su = 0.0;
+        for (int j=0; j < num_states_; j++) {
+            if (i != j) {
+                su += Q(i, j);
+            }
+        }
+        Q(i, i) = -su;
+        mu += freqs_[i] * su;
+    }
+    for (int i=0; i < num_states_; i++) {
+        for (int j=0; j < num_states_; j++) {
+            Q(i, j) /= mu;
+        }
+    }
+    rm_.set_Q(Q);
+    if (!reversible_eigensystem(rm_.get_Q(), eigval_, left_, right_)) {
+        std::cerr << "Error: could not decompose the rate matrix. Exiting." << std::endl;
+        exit(0);
+    }
+}
+
+
+void SeqLikelihood::setup_rate_categories () {
+    if (alpha_ > 0.0 && num_cats_ > 1) {
+        cat_rates_ = discrete_gamma_rates(alpha_, num_cats_);
+    } else {
+        num_cats_ = 1;
+        cat_rates_.assign(1, 1.0);
+    }
+}
+
+
+/*
+ * the transition matrix of every rate category over a branch, laid out
+ * [category][from][to] so a row is contiguous with a partial vector
+ */
+void SeqLikelihood::fill_p_matrices (const double& bl, std::vector<double>& pm) const {
+    int ns = num_states_;
+    pm.resize((size_t)num_cats_ * ns * ns);
+    mat P;
+    for (int c=0; c < num_cats_; c++) {
+        reversible_p_matrix(eigval_, left_, right_, bl * cat_rates_[c], P);
+        double * pc = &pm[(size_t)c * ns * ns];
+        for (int i=0; i < ns; i++) {
+            for (int j=0; j < ns; j++) {
+                double v = P(i, j);
+                pc[i * ns + j] = (v > 0.0) ? v : 0.0; // roundoff on tiny entries
+            }
+        }
+    }
+}
+
+
+/*
+ * felsenstein pruning over the patterns. each internal node keeps one
+ * contiguous [pattern][category][state] block. when every entry of a pattern
+ * gets small it is rescaled and the pattern's scale count bumped; one count
+ * per pattern suffices because the rescalings of all nodes just add up in
+ * log space. tips are not stored, their state sets are read directly
+ */
+double SeqLikelihood::calc_log_likelihood (Tree * tree) const {
+    int ns = num_states_;
+    int nc = num_cats_;
+    int block = nc * ns;
+    unsigned int all = patterns_.get_all_states_mask();
+    const std::vector<int>& weights = patterns_.get_pattern_weights();
+
+    // postorder, and a row for each internal node
+    std::vector<Node *> order;
+    std::vector<Node *> stack;
+    stack.push_back(tree->getRoot());
+    while (!stack.empty()) {
+        Node * nd = stack.back();
+        stack.pop_back();
+        order.push_back(nd);
+        for (int i=0; i < nd->getChildCount(); i++) {
+            stack.push_back(nd->getChild(i));
+        }
+    }
+    std::unordered_map<Node *, int> rows;
+    int num_tips = 0;
+    for (int i=(int)order.size()-1, r=0; i >= 0; i--) {
+        if (order[i]->getChildCount() > 0) {
+            rows[order[i]] = r++;
+        } else {
+            if (patterns_.get_taxon_index(order[i]->getName()) < 0) {
+                std::cerr << "Error: taxon '" << order[i]->getName()
+                    << "' in the tree is not in the alignment. Exiting." << std::endl;
+                exit(0);
+            }
+            num_tips++;
+        }
+    }
+    if (num_tips != patterns_.get_num_taxa()) {
+        std::cerr << "Error: the tree has " << num_tips << " tips but the alignment has "
+            << patterns_.get_num_taxa() << " taxa. Exiting." << std::endl;
+        exit(0);
+    }
+    if (rows.empty()) {
+        std::cerr << "Error: the tree has no internal nodes. Exiting." << std::endl;
+        exit(0);
+    }
+
+    LikelihoodWorkspace<double> partials((int)rows.size(), num_patterns_ * block);
+    std::vector<int> scale_count(num_patterns_, 0);
+    std::vector<double> pm;
+    const double scale_min = ldexp(1.0, -SCALE_EXP);
+    const double scale_up = ldexp(1.0, SCALE_EXP);
+
+    for (int i=(int)order.size()-1; i >= 0; i--) {
+        Node * nd = order[i];
+        if (nd->getChildCount() == 0) {
+            continue;
+        }
+        double * cur = partials.row(rows[nd]);
+        for (int k=0; k < num_patterns_ * block; k++) {
+            cur[k] = 1.0;
+        }
+        for (int ch=0; ch < nd->getChildCount(); ch++) {
+            Node * child = nd->getChild(ch);
+            fill_p_matrices(child->getBL(), pm);
+            if (child->getChildCount() == 0) {
+                const std::vector<unsigned int>& masks =
+                    patterns_.get_tip_masks(patterns_.get_taxon_index(child->getName()));
+                for (int p=0; p < num_patterns_; p++) {
+                    unsigned int m = masks[p];
+                    if (m == all) {
+                        continue; // rows of P sum to one
+                    }
+                    double * cp = cur + (size_t)p * block;
+                    for (int c=0; c < nc; c++) {
+                        const double * pc = &pm[(size_t)c * ns * ns];
+                        for (int s=0; s < ns; s++) {
+                            double v = 0.0;
+                            for (int t=0; t < ns; t++) {
+                                if (m & (1u << t)) {
+                                    v += pc[s * ns + t];
+                                }
+                            }
+                            cp[c * ns + s] *= v;
+                        }
+                    }
+                }
+            } else {
+                const double * crow = partials.row(rows[child]);
+                for (int p=0; p < num_patterns_; p++) {
+                    double * cp = cur + (size_t)p * block;
+                    const double * chp = crow + (size_t)p * block;
+                    for (int c=0; c < nc; c++) {
+                        const double * pc = &pm[(size_t)c * ns * ns];
+                        const double * x = chp + c * ns;
+                        for (int s=0; s < ns; s++) {
+                            const double * prow = pc + s * ns;
+                            double v = 0.0;
+                            for (int t=0; t < ns; t++) {
+                                v += prow[t] * x[t];
+                            }
+                            cp[c * ns + s] *= v;
+                        }
+                    }
+                }
+            }
+        }
+        for (int p=0; p < num_patterns_; p++) {
+            double * cp = cur + (size_t)p * block;
+            double mx = 0.0;
+            for (int k=0; k < block; k++) {
+                if (cp[k] > mx) {
+                    mx = cp[k];
+                }
+            }
+            if (mx > 0.0 && mx < scale_min) {
+                for (int k=0; k < block; k++) {
+                    cp[k] *= scale_up;
+                }
+                scale_count[p]++;
+            }
+        }
+    }
+
+    const double * root = partials.row(rows[tree->getRoot()]);
+    double lnl = 0.0;
+    for (int p=0; p < num_patterns_; p++) {
+        const double * cp = root + (size_t)p * block;
+        double lp = 0.0;
+        for (int c=0; c < nc; c++) {
+            for (int s=0; s < ns; s++) {
+                lp += freqs_[s] * cp[c * ns + s];
+            }
+        }
+        lp /= nc;
+        lnl += weights[p] * (log(lp) - scale_count[p] * SCALE_EXP * log(2.0));
+    }
+    return lnl;
+}
+
+
+int SeqLikelihood::get_num_sites () const {
+    return patterns_.get_num_sites();
+}
+
+
+int SeqLikelihood::get_num_patterns () const {
+    return num_patterns_;
+}
+
+
+std::vector<double> SeqLikelihood::get_category_rates () const {
+    return cat_rates_;
+}
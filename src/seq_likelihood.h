@@ -0,0 +1,55 @@
+#ifndef _SEQ_LIKELIHOOD_H_
+#define _SEQ_LIKELIHOOD_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <armadillo>
+
+#include "sequence.h"
+#include "tree.h"
+#include "rate_model.h"
+#include "site_patterns.h"
+
+using namespace arma;
+
+
+/*
+ * likelihood of a DNA or amino acid alignment on a tree under a reversible
+ * model (GTR for DNA; user exchangeabilities and frequencies for AA) with
+ * discrete-gamma rate categories, summed over the weighted site patterns of
+ * the alignment. the model is fixed at construction, so scoring a tree only
+ * reads shared state and any number of trees can be scored at once from
+ * different threads
+ */
+class SeqLikelihood {
+private:
+    SitePatterns patterns_;
+    int num_states_;
+    int num_patterns_;
+    int num_cats_;
+    double alpha_;
+    std::vector<double> freqs_;
+    std::vector<double> cat_rates_;
+
+    RateModel rm_;
+    vec eigval_;
+    mat left_;
+    mat right_;
+
+    void setup_model (const std::vector<double>& exchangeabilities);
+    void setup_rate_categories ();
+    void fill_p_matrices (const double& bl, std::vector<double>& pm) const;
+
+public:
+    SeqLikelihood (const std::vector<Sequence>& seqs, const bool& is_dna,
+        const std::vector<double>& freqs, const std::vector<double>& exchangeabilities,
+        const double& alpha, const int& ncats);
+    double calc_log_likelihood (Tree * tree) const;
+    int get_num_sites () const;
+    int get_num_patterns () const;
+    std::vector<double> get_category_rates () const;
+};
+
+#endif /* _SEQ_LIKELIHOOD_H_ */
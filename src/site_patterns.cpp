@@ -0,0 +1,173 @@
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <cctype>
+#include <cstdlib>
+
+#include "site_patterns.h"
+#include "seq_utils.h"
+
+
+SitePatterns::SitePatterns (const std::vector<Sequence>& seqs, const bool& is_dna):
+        num_states_(is_dna ? 4 : 20), num_taxa_(0), num_sites_(0),
+        states_(is_dna ? "ACGT" : "ARNDCQEGHILKMFPSTWYV") {
+    compress(seqs);
+}
+
+
+/*
+ * the set of states an alignment character could be. 0 means the character
+ * is not valid for this alphabet
+ */
+unsigned int SitePatterns::get_state_mask (const char& c) const {
+    char ch = (char)toupper(c);
+    unsigned int all = get_all_states_mask();
+    if (ch == '-' || ch == '?' || ch == '.') {
+        return all;
+    }
+    if (num_states_ == 4) {
+        switch (ch) {
+            case 'A': return 1;
+            case 'C': return 2;
+            case 'G': return 4;
+            case 'T': return 8;
+            case 'U': return 8;
+            case 'R': return 1 | 4;
+            case 'Y': return 2 | 8;
+            case 'S': return 2 | 4;
+            case 'W': return 1 | 8;
+            case 'K': return 4 | 8;
+            case 'M': return 1 | 2;
+            case 'B': return 2 | 4 | 8;
+            case 'D': return 1 | 4 | 8;
+            case 'H': return 1 | 2 | 8;
+            case 'V': return 1 | 2 | 4;
+            case 'N': return all;
+            case 'X': return all;
+            default: return 0;
+        }
+    }
+    size_t pos = states_.find(ch);
+    if (pos != std::string::npos) {
+        return 1u << pos;
+    }
+    switch (ch) {
+        case 'B': return (1u << states_.find('D')) | (1u << states_.find('N'));
+        case 'Z': return (1u << states_.find('E')) | (1u << states_.find('Q'));
+        case 'J': return (1u << states_.find('I')) | (1u << states_.find('L'));
+        case 'X': return all;
+        case '*': return all;
+        default: return 0;
+    }
+}
+
+
+void SitePatterns::compress (const std::vector<Sequence>& seqs) {
+    if (seqs.empty()) {
+        std::cerr << "Error: no sequences read. Exiting." << std::endl;
+        exit(0);
+    }
+    if (!is_aligned(seqs)) {
+        std::cerr << "Error: sequences must be aligned. Exiting." << std::endl;
+        exit(0);
+    }
+    num_taxa_ = (int)seqs.size();
+    num_sites_ = (int)seqs[0].get_sequence().length();
+    for (int i=0; i < num_taxa_; i++) {
+        if (taxon_index_.count(seqs[i].get_id()) != 0) {
+            std::cerr << "Error: taxon '" << seqs[i].get_id()
+                << "' appears more than once in the alignment. Exiting." << std::endl;
+            exit(0);
+        }
+        taxon_index_[seqs[i].get_id()] = i;
+    }
+
+    std::vector< std::vector<unsigned int> > columns(num_sites_,
+        std::vector<unsigned int>(num_taxa_, 0));
+    for (int i=0; i < num_taxa_; i++) {
+        std::string str = seqs[i].get_sequence();
+        for (int j=0; j < num_sites_; j++) {
+            unsigned int m = get_state_mask(str[j]);
+            if (m == 0) {
+                std::cerr << "Error: character '" << str[j] << "' of taxon '"
+                    << seqs[i].get_id() << "' is not valid for this alignment type. Exiting."
+                    << std::endl;
+                exit(0);
+            }
+            columns[j][i] = m;
+        }
+    }
+
+    std::map<std::vector<unsigned int>, int> pattern_index;
+    site_patterns_.resize(num_sites_);
+    for (int j=0; j < num_sites_; j++) {
+        std::map<std::vector<unsigned int>, int>::iterator it = pattern_index.find(columns[j]);
+        if (it == pattern_index.end()) {
+            int p = (int)pattern_weights_.size();
+            pattern_index[columns[j]] = p;
+            pattern_weights_.push_back(1);
+            site_patterns_[j] = p;
+        } else {
+            pattern_weights_[it->second]++;
+            site_patterns_[j] = it->second;
+        }
+    }
+
+    tip_masks_.assign(num_taxa_, std::vector<unsigned int>(pattern_weights_.size(), 0));
+    for (int j=0; j < num_sites_; j++) {
+        for (int i=0; i < num_taxa_; i++) {
+            tip_masks_[i][site_patterns_[j]] = columns[j][i];
+        }
+    }
+}
+
+
+int SitePatterns::get_num_states () const {
+    return num_states_;
+}
+
+
+int SitePatterns::get_num_taxa () const {
+    return num_taxa_;
+}
+
+
+int SitePatterns::get_num_sites () const {
+    return num_sites_;
+}
+
+
+int SitePatterns::get_num_patterns () const {
+    return (int)pattern_weights_.size();
+}
+
+
+unsigned int SitePatterns::get_all_states_mask () const {
+    return (1u << num_states_) - 1;
+}
+
+
+// -1 if the taxon is not in the alignment
+int SitePatterns::get_taxon_index (const std::string& name) const {
+    std::map<std::string, int>::const_iterator it = taxon_index_.find(name);
+    if (it == taxon_index_.end()) {
+        return -1;
+    }
+    return it->second;
+}
+
+
+const std::vector<unsigned int>& SitePatterns::get_tip_masks (const int& taxon) const {
+    return tip_masks_[taxon];
+}
+
+
+const std::vector<int>& SitePatterns::get_pattern_weights () const {
+    return pattern_weights_;
+}
+
+
+const std::vector<int>& SitePatterns::get_site_patterns () const {
+    return site_patterns_;
+}
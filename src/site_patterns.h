@@ -0,0 +1,45 @@
+#ifndef _SITE_PATTERNS_H_
+#define _SITE_PATTERNS_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "sequence.h"
+
+
+/*
+ * a DNA or amino acid alignment with every character turned into the set of
+ * states it could be (one bit per state; ambiguity codes give several bits,
+ * gaps and missing data all of them) and identical columns collapsed into
+ * patterns, each weighted by the number of sites that have it
+ */
+class SitePatterns {
+private:
+    int num_states_;
+    int num_taxa_;
+    int num_sites_;
+    std::string states_; // the alphabet, in state (bit) order
+
+    std::map<std::string, int> taxon_index_;
+    std::vector< std::vector<unsigned int> > tip_masks_; // [taxon][pattern]
+    std::vector<int> pattern_weights_;
+    std::vector<int> site_patterns_; // which pattern each site is
+
+    unsigned int get_state_mask (const char& c) const;
+    void compress (const std::vector<Sequence>& seqs);
+
+public:
+    SitePatterns (const std::vector<Sequence>& seqs, const bool& is_dna);
+    int get_num_states () const;
+    int get_num_taxa () const;
+    int get_num_sites () const;
+    int get_num_patterns () const;
+    unsigned int get_all_states_mask () const;
+    int get_taxon_index (const std::string& name) const;
+    const std::vector<unsigned int>& get_tip_masks (const int& taxon) const;
+    const std::vector<int>& get_pattern_weights () const;
+    const std::vector<int>& get_site_patterns () const;
+};
+
+#endif /* _SITE_PATTERNS_H_ */
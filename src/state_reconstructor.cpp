@@ -1,13 +1,15 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <complex>
+#include <algorithm>
 
 #include "state_reconstructor.h"
 #include "tree.h"
 #include "rate_model.h"
 #include "node.h"
 #include "utils.h"
-#include "vector_node_object.h"
 #include "sequence.h"
 #include "superdouble.h"
 
@@ -15,32 +17,45 @@
 
 #define MINBL 0.000000001
 
+// conditionals are rescaled once the largest at a node falls below this
+#define SCALE_BELOW 1e-100
+
 
 StateReconstructor::StateReconstructor (RateModel& _rm, std::vector<RateModel>& _vrm):tree(NULL),
-    use_periods(false), nstates(_rm.nstates), rm(_rm), rm_periods(_vrm), dc("dist_conditionals"),
-    andc("anc_dist_conditionals"), store_p_matrices(false), use_stored_matrices(false), revB("revB"),
-    rev(false), rev_exp_number("rev_exp_number"), rev_exp_time("rev_exp_time"),
-    stochastic(false), stored_EN_matrices(std::map<Superdouble, mat >()),
-    stored_ER_matrices(std::map<Superdouble, mat >()), sp_alphas("sp_alphas"), alphas("alphas") {}
+    use_periods(false), nstates(_rm.nstates), rm(_rm), rm_periods(_vrm), store_p_matrices(false),
+    use_stored_matrices(false), use_scaled(true), rev(false), stochastic(false),
+    stored_EN_matrices(), stored_ER_matrices(), logs(&std::cout) {}
+
+
+/*
+ * where the progress and tip echo go. the site patterns of pxstrec each have
+ * a reconstructor and run in parallel, so each one logs to its own buffer
+*/
+void StateReconstructor::set_log_stream (std::ostream * los) {
+    logs = los;
+}
 
 
 /**
  * need to do this before you do the set tree
 */
-void StateReconstructor::set_periods (std::vector<double>& ps, std::vector<RateModel>& rms) {
+void StateReconstructor::set_periods (const std::vector<double>& ps, std::vector<RateModel>& rms) {
     use_periods = true;
     periods = ps;
     rm_periods = rms;
+    period_versions.clear();
+    grad_versions.clear();
 }
 
 
 /*
- * initialize each node with segments
+ * number the nodes (postorder, so children come before their parents) and
+ * set up the workspaces. initialize each node with segments
 */
 void StateReconstructor::set_tree (Tree * tr) {
     tree = tr;
     if (verbose) {
-        std::cout << "initializing nodes..." << std::endl;
+        (*logs) << "initializing nodes..." << std::endl;
     }
     for (int i=0; i < tree->getNodeCount(); i++) {
         if (tree->getNode(i)->getBL()<MINBL) {
@@ -49,15 +64,47 @@ void StateReconstructor::set_tree (Tree * tr) {
         if (use_periods == true) {
             tree->getNode(i)->initSegVector();
         }
-        VectorNodeObject<Superdouble> * dcs = new VectorNodeObject<Superdouble>(nstates);
-        tree->getNode(i)->assocObject(dc,*dcs);
-        delete dcs;
     }
+    nodes.clear();
+    node_rows.clear();
+    std::vector<std::pair<Node *, int> > stack;
+    stack.push_back(std::make_pair(tree->getRoot(), 0));
+    while (!stack.empty()) {
+        Node * nd = stack.back().first;
+        int next = stack.back().second;
+        if (next < nd->getChildCount()) {
+            stack.back().second++;
+            stack.push_back(std::make_pair(nd->getChild(next), 0));
+        } else {
+            stack.pop_back();
+            node_rows[nd] = (int)nodes.size();
+            nodes.push_back(nd);
+        }
+    }
+    int nnodes = (int)nodes.size();
+    parents.assign(nnodes, -1);
+    children.assign(nnodes, std::vector<int>());
+    for (int i=0; i < nnodes; i++) {
+        for (int j=0; j < nodes[i]->getChildCount(); j++) {
+            int c = node_rows[nodes[i]->getChild(j)];
+            children[i].push_back(c);
+            parents[c] = i;
+        }
+    }
+    conds.resize(nnodes, nstates);
+    alphas.resize(nnodes, nstates);
+    revB.resize(nnodes, nstates);
+    scaled_conds.resize(nnodes, nstates, 1.0);
+    scaled_lns.assign(nnodes, 0.0);
+    period_alphas.resize(nnodes, nstates);
+    invalidate_periods();
     /*
      * initialize the actual branch segments for each node
      */
     if (use_periods == true) {
-        std::cout << "initializing branch segments..." << std::endl;
+        if (verbose) {
+            (*logs) << "initializing branch segments..." << std::endl;
+        }
         tree->setHeightFromTipToNodes();
         for (int i=0; i < tree->getNodeCount(); i++) {
             if (tree->getNode(i)->hasParent()) {
@@ -95,6 +142,16 @@ void StateReconstructor::set_tree (Tree * tr) {
 }
 
 
+int StateReconstructor::get_row (Node& node) const {
+    std::unordered_map<Node *, int>::const_iterator it = node_rows.find(&node);
+    if (it == node_rows.end()) {
+        std::cerr << "Error: node is not in the reconstruction tree. Exiting." << std::endl;
+        exit(0);
+    }
+    return it->second;
+}
+
+
 /**
  * this will setup the distconds and ancdistconds for each segment
 */
@@ -109,12 +166,6 @@ void StateReconstructor::set_periods_model () {
             tsegs->at(j).ancdistconds = ancdistconds;
         }
     }
-    std::vector<Superdouble> * distconds = new std::vector<Superdouble> (nstates, 0);
-    tree->getRoot()->assocDoubleVector(dc,*distconds);
-    delete distconds;
-    std::vector<Superdouble> * ancdistconds = new std::vector<Superdouble> (nstates, 0);
-    tree->getRoot()->assocDoubleVector(andc, *ancdistconds);
-    delete ancdistconds;
 }
 
 
@@ -124,18 +175,21 @@ bool StateReconstructor::set_tip_conditionals (std::vector<Sequence>& data) {
     for (unsigned int i=0; i < data.size(); i++) {
         Sequence seq = data[i];
         Node * nd = tree->getExternalNode(seq.get_id());
+        int row = get_row(*nd);
         if (verbose) {
-            std::cout << nd->getName() << " ";
+            (*logs) << nd->getName() << " ";
             }
         if (use_periods == false) {
             for (int j=0; j < nstates; j++) {
             if (seq.get_sequence().at(j) == '1') {
-                (((VectorNodeObject<Superdouble>*) nd->getObject(dc)))->at(j) = 1.0;
+                conds.at(row, j) = 1.0;
+                scaled_conds.at(row, j) = 1.0;
             } else {
-                (((VectorNodeObject<Superdouble>*) nd->getObject(dc)))->at(j) = 0.0;
+                conds.at(row, j) = 0.0;
+                scaled_conds.at(row, j) = 0.0;
                     }
             if (verbose) {
-                std::cout << seq.get_sequence().at(j);
+                (*logs) << seq.get_sequence().at(j);
                     }
             }
         } else {
@@ -147,12 +201,12 @@ bool StateReconstructor::set_tip_conditionals (std::vector<Sequence>& data) {
                     tsegs->at(0).distconds->at(j) = 0.0;
                         }
                 if (verbose) {
-                    std::cout << seq.get_sequence().at(j);
+                    (*logs) << seq.get_sequence().at(j);
                 }
             }
         }    
         if (verbose) {
-            std::cout << std::endl;
+            (*logs) << std::endl;
             }
         if (testsame != seq.get_sequence()) {
             allsame = false;
@@ -161,6 +215,7 @@ bool StateReconstructor::set_tip_conditionals (std::vector<Sequence>& data) {
     if (allsame == true && verbose == true) {
         std::cerr << "all the tips have the same characters" << std::endl;
     }
+    invalidate_periods();
     return allsame;
 }
 
@@ -170,19 +225,21 @@ bool StateReconstructor::set_tip_conditionals_already_given (std::vector<Sequenc
     for (unsigned int i=0; i < data.size(); i++) {
     Sequence seq = data[i];
     Node * nd = tree->getExternalNode(seq.get_id());
+    int row = get_row(*nd);
     std::vector<std::string> searchtokens;
     tokenize(seq.get_sequence(), searchtokens, ",");
     for (unsigned int j=0; j < searchtokens.size(); j++) {
         trim_spaces(searchtokens[j]);
     }
     if (verbose) {
-        std::cout << nd->getName() << " ";
+        (*logs) << nd->getName() << " ";
     }
     if (use_periods == false) {
         for (int j=0; j < nstates; j++) {
-            (((VectorNodeObject<Superdouble>*) nd->getObject(dc)))->at(j) = atof(searchtokens[j].c_str());
+            conds.at(row, j) = atof(searchtokens[j].c_str());
+            scaled_conds.at(row, j) = atof(searchtokens[j].c_str());
             if (verbose) {
-                std::cout << searchtokens[j];
+                (*logs) << searchtokens[j];
             }
         }
     } else {
@@ -190,49 +247,56 @@ bool StateReconstructor::set_tip_conditionals_already_given (std::vector<Sequenc
         for (int j=0; j < nstates; j++) {
         tsegs->at(0).distconds->at(j) = atof(searchtokens[j].c_str());
         if (verbose) {
-            std::cout << searchtokens[j];
+            (*logs) << searchtokens[j];
                 }
         }
     }    
     if (verbose) {
-        std::cout << std::endl;
+        (*logs) << std::endl;
         }
     }
+    invalidate_periods();
     return allsame;
 }
 
 
-VectorNodeObject<Superdouble> StateReconstructor::conditionals (Node& node) {
-    VectorNodeObject<Superdouble> distconds = *((VectorNodeObject<Superdouble>*) node.getObject(dc));
-    VectorNodeObject<Superdouble> * v = new VectorNodeObject<Superdouble> (nstates, 0);
+/*
+ * the conditionals of a node carried up its branch (into v). these are the
+ * node's alphas, which are kept if the p matrices are being stored
+ */
+void StateReconstructor::conditionals (const int& row, std::vector<Superdouble>& v) {
+    Superdouble * distconds = conds.row(row);
     cx_mat p;
     if (use_stored_matrices == false) {
-        p= rm.setup_P(node.getBL(), store_p_matrices);
+        p= rm.setup_P(nodes[row]->getBL(), store_p_matrices);
     } else {
-        p = rm.stored_p_matrices[node.getBL()];
+        p = rm.stored_p_matrices[nodes[row]->getBL()];
     }
     for (int j=0; j < nstates; j++) {
+        v[j] = 0;
         for (int k=0; k < nstates; k++) {
-            v->at(j) += (distconds.at(k)*real(p(j, k)));
+            v[j] += (distconds[k]*real(p(j, k)));
         }
     }
-    for (unsigned int j=0; j < distconds.size(); j++) {
-        distconds[j] = v->at(j);
-    }
     if (store_p_matrices == true) {
-        node.assocObject(sp_alphas, distconds);
-        node.assocObject(alphas, distconds);
+        Superdouble * a = alphas.row(row);
+        for (int j=0; j < nstates; j++) {
+            a[j] = v[j];
+        }
     }
-    delete v;
-    return distconds;
 }
 
 
-VectorNodeObject<Superdouble> StateReconstructor::conditionals_periods (Node& node) {
+/*
+ * the conditionals of a node carried up the segments of its branch. each
+ * segment keeps the conditionals at its bottom, so when the segments below
+ * start are unchanged the pass can begin there
+ */
+std::vector<Superdouble> StateReconstructor::conditionals_periods (Node& node, const unsigned int& start) {
     std::vector<Superdouble> distconds;
     std::vector<BranchSegment> * tsegs = node.getSegVector();
-    distconds = *tsegs->at(0).distconds;
-    for (unsigned int i=0; i < tsegs->size(); i++) {
+    distconds = *tsegs->at(start).distconds;
+    for (unsigned int i=start; i < tsegs->size(); i++) {
         for (unsigned int j=0; j < distconds.size(); j++) {
             tsegs->at(i).distconds->at(j) = distconds.at(j);
         }
@@ -242,7 +306,7 @@ VectorNodeObject<Superdouble> StateReconstructor::conditionals_periods (Node& no
         cx_mat p;
         if (use_stored_matrices == false) {
             //p= trm->setup_fortran_P(tsegs->at(i).getPeriod(), tsegs->at(i).getDuration(), store_p_matrices);
-            p = trm->setup_P(tsegs->at(i).getDuration(), store_p_matrices);
+            p = trm->setup_P(tsegs->at(i).getDuration(), store_p_matrices, tsegs->at(i).getPeriod());
         } else {
             //p = trm->stored_p_matrices[tsegs->at(i).getPeriod()][tsegs->at(i).getDuration()];
             p = trm->stored_p_matrices[tsegs->at(i).getDuration()];
@@ -268,157 +332,560 @@ VectorNodeObject<Superdouble> StateReconstructor::conditionals_periods (Node& no
     if (store_p_matrices == true) {
         tsegs->at(0).alphas = distconds;
     }
-    VectorNodeObject<Superdouble> rdistconds(distconds.size());
-    for (unsigned int i=0; i < distconds.size(); i++) {
-        rdistconds[i] = distconds[i];
+    return distconds;
+}
+
+
+/*
+ * which period models have had their rates changed since the last pass
+ * (see RateModel::get_Q_version)
+ */
+std::vector<bool> StateReconstructor::changed_periods () {
+    std::vector<bool> changed(rm_periods.size(), true);
+    if (period_versions.size() != rm_periods.size()) {
+        period_versions.assign(rm_periods.size(), 0);
+        invalidate_periods();
+    }
+    for (unsigned int k=0; k < rm_periods.size(); k++) {
+        unsigned long ver = rm_periods[k].get_Q_version();
+        changed[k] = (ver != period_versions[k]);
+        period_versions[k] = ver;
     }
-    return rdistconds;
+    return changed;
 }
 
 
-void StateReconstructor::ancdist_conditional_lh (Node& node) {
-    VectorNodeObject<Superdouble> distconds(nstates, 0);
-    if (node.isExternal() == false) { // is not a tip
-        Node * c1 = node.getChild(0);
-        Node * c2 = node.getChild(1);
-        ancdist_conditional_lh(*c1);
-        ancdist_conditional_lh(*c2);
-        VectorNodeObject<Superdouble> v1;
-        VectorNodeObject<Superdouble> v2;
-        if (use_periods == false) {
-            v1 =conditionals(*c1);
-            v2 =conditionals(*c2);
-        } else {
-            v1 = conditionals_periods(*c1);
-            v2 = conditionals_periods(*c2);
+/*
+ * the first segment of the branch above row that has to be redone: 0 if the
+ * node's conditionals are stale (or the p matrices are being stored or
+ * reused, which always takes the full pass), else the lowest segment in a
+ * changed period. the number of segments means nothing changed
+ */
+unsigned int StateReconstructor::first_changed_segment (const int& row, const std::vector<bool>& changed) {
+    if (period_alpha_valid[row] == false || store_p_matrices == true || use_stored_matrices == true) {
+        return 0;
+    }
+    std::vector<BranchSegment> * tsegs = nodes[row]->getSegVector();
+    for (unsigned int i=0; i < tsegs->size(); i++) {
+        if (changed[tsegs->at(i).getPeriod()] == true) {
+            return i;
+        }
+    }
+    return tsegs->size();
+}
+
+
+void StateReconstructor::invalidate_periods () {
+    period_alpha_valid.assign(nodes.size(), false);
+    grad_valid.assign(nodes.size(), false);
+}
+
+
+/*
+ * the pruning pass. with periods, the segments of a branch that are below
+ * the first one whose period changed rates (and whole branches with nothing
+ * changed beneath them) are not redone
+ */
+void StateReconstructor::ancdist_conditional_lh () {
+    std::vector<Superdouble> v(nstates, 0);
+    std::vector<Superdouble> distconds(nstates, 0);
+    std::vector<bool> changed;
+    if (use_periods == true) {
+        changed = changed_periods();
+    }
+    for (unsigned int r=0; r < nodes.size(); r++) {
+        Node * node = nodes[r];
+        if (node->isExternal() == true) {
+            continue;
         }
         for (int i=0; i < nstates; i++) {
-            distconds.at(i)= v1[i] * v2[i];
-        }
-        //if (node.isRoot()) {
-            //with equal freq!
-        //    for (int i=0; i < nstates; i++) {
-    //        distconds.at(i) = distconds.at(i) * (1./nstates);
-    //        }
-        //}
-    } else {
-        if (use_periods == false) {
-            distconds = *((VectorNodeObject<Superdouble>*)node.getObject(dc));
+            distconds[i] = 1.0;
+        }
+        bool moved = false;
+        for (unsigned int c=0; c < children[r].size(); c++) {
+            if (use_periods == false) {
+                conditionals(children[r][c], v);
+            } else {
+                int crow = children[r][c];
+                unsigned int start = first_changed_segment(crow, changed);
+                Superdouble * a = period_alphas.row(crow);
+                if (start < nodes[crow]->getSegVector()->size()) {
+                    v = conditionals_periods(*nodes[crow], start);
+                    for (int i=0; i < nstates; i++) {
+                        a[i] = v[i];
+                    }
+                    period_alpha_valid[crow] = true;
+                    moved = true;
+                } else {
+                    for (int i=0; i < nstates; i++) {
+                        v[i] = a[i];
+                    }
+                }
+            }
+            for (int i=0; i < nstates; i++) {
+                distconds[i] *= v[i];
+            }
+        }
+        if (moved == true) {
+            //the node's own conditionals changed, so all of its branch is redone
+            period_alpha_valid[r] = false;
+        }
+        if (use_periods == true && node->hasParent() == true) {
+            std::vector<BranchSegment> * tsegs = node->getSegVector();
+            for (int i=0; i < nstates; i++) {
+                tsegs->at(0).distconds->at(i) = distconds[i];
+            }
         } else {
-            std::vector<BranchSegment> * tsegs = node.getSegVector();
-            //distconds = *tsegs->at(0).distconds;
-            for (unsigned int i=0; i < distconds.size(); i++) {
-                distconds[i] = tsegs->at(0).distconds->at(i);
+            Superdouble * nodeconds = conds.row(r);
+            for (int i=0; i < nstates; i++) {
+                nodeconds[i] = distconds[i];
             }
         }
     }
-    if (use_periods == false) {
-        for (unsigned int i=0; i < distconds.size(); i++) {
-            ((VectorNodeObject<Superdouble>*)node.getObject(dc))->at(i) = distconds.at(i);
+}
+
+
+/*
+ * the same pruning pass as ancdist_conditional_lh in plain doubles. when the
+ * largest conditional at a node drops below SCALE_BELOW they are divided by
+ * it and its log is carried up, so nothing underflows on big trees. returns
+ * the summed log scalers of the tree
+ */
+double StateReconstructor::ancdist_conditional_lh_scaled () {
+    for (unsigned int r=0; r < nodes.size(); r++) {
+        if (children[r].empty()) {
+            continue;
         }
-    } else {
-        if (node.hasParent() == true) {
-            std::vector<BranchSegment> * tsegs = node.getSegVector();
-            for (unsigned int i=0; i < distconds.size(); i++) {
-                tsegs->at(0).distconds->at(i) = distconds.at(i);
+        double * distconds = scaled_conds.row(r);
+        double lnscale = 0.0;
+        for (int i=0; i < nstates; i++) {
+            distconds[i] = 1.0;
+        }
+        for (unsigned int c=0; c < children[r].size(); c++) {
+            int crow = children[r][c];
+            const double * childconds = scaled_conds.row(crow);
+            lnscale += scaled_lns[crow];
+            cx_mat p;
+            if (use_stored_matrices == false) {
+                p = rm.setup_P(nodes[crow]->getBL(), false);
+            } else {
+                p = rm.stored_p_matrices[nodes[crow]->getBL()];
             }
-        } else {
-            for (unsigned int i=0; i < distconds.size(); i++) {
-                ((VectorNodeObject<Superdouble>*)node.getObject(dc))->at(i) = distconds.at(i);
+            for (int j=0; j < nstates; j++) {
+                double v = 0.0;
+                for (int k=0; k < nstates; k++) {
+                    v += childconds[k] * real(p(j, k));
+                }
+                distconds[j] *= v;
+            }
+        }
+        double largest = 0.0;
+        for (int i=0; i < nstates; i++) {
+            if (distconds[i] > largest) {
+                largest = distconds[i];
+            }
+        }
+        if (largest > 0.0 && largest < SCALE_BELOW) {
+            for (int i=0; i < nstates; i++) {
+                distconds[i] /= largest;
             }
+            lnscale += log(largest);
         }
+        scaled_lns[r] = lnscale;
     }
+    return scaled_lns[nodes.size()-1];
 }
 
 
+/*
+ * the scaled double pass is used while optimizing. the superdouble pass is
+ * kept for periods and for the final evaluation (store_p_matrices), which
+ * leaves the alphas for the reverse and stochastic mapping
+ */
 double StateReconstructor::eval_likelihood () {
-    ancdist_conditional_lh(*tree->getRoot());
-    //return (-log(calculate_vector_double_sum(*
-    //      (VectorNodeObject<Superdouble>*) tree->getRoot()->getObject(dc))));
-    return double(-(calculate_vector_Superdouble_sum(*(VectorNodeObject<Superdouble>*) tree->getRoot()->getObject(dc))).getLn());
+    int root = (int)nodes.size() - 1;
+    if (use_scaled == true && use_periods == false && store_p_matrices == false) {
+        double lnscale = ancdist_conditional_lh_scaled();
+        double totlike = 0.0;
+        const double * distconds = scaled_conds.row(root);
+        for (int i=0; i < nstates; i++) {
+            totlike += distconds[i];
+        }
+        return -(log(totlike) + lnscale);
+    }
+    ancdist_conditional_lh();
+    Superdouble totlike = 0;
+    const Superdouble * distconds = conds.row(root);
+    for (int i=0; i < nstates; i++) {
+        totlike += distconds[i];
+    }
+    return double(-totlike.getLn());
 }
 
 
-void StateReconstructor::prepare_ancstate_reverse () {
-    reverse(tree->getRoot());
+/*
+ * F_kl of the derivative of a p matrix below: (e_k - e_l) / (l_k - l_l),
+ * or its limit when the two eigenvalues are (nearly) the same
+ */
+static inline cx_double exp_difference (const cx_double& lk, const cx_double& ll,
+        const cx_double& ek, const cx_double& el, const double& t) {
+    cx_double d = (lk - ll) * t;
+    if (std::abs(d) < 1e-6) {
+        return el * t * (1.0 + d / 2.0 + d * d / 6.0);
+    }
+    return (ek - el) / (lk - ll);
 }
 
 
-void StateReconstructor::reverse (Node * node) {
-    rev = true;
-    VectorNodeObject<Superdouble> * revconds = new VectorNodeObject<Superdouble> (nstates, 0);//need to delete this at some point
-    if (node == tree->getRoot()) {
+/*
+ * -lnL and its derivatives with respect to every off-diagonal cell of each
+ * Q (one per period, or just the one), the diagonal following along as in
+ * set_Q_diag. with Q = A diag(l) B, a branch (segment) of length t with the
+ * outside vector o above it and the conditionals c below it adds
+ *   o' dP c = sum_kl (A'o)_k F_kl (Bc)_l (B dQ A)_kl
+ * so with H the sum of (A'o)_k F_kl (Bc)_l over the branches, dlnL/dQ_ij
+ * is (B'HA')_ij - (B'HA')_ii. the pruning and the preorder passes are in
+ * scaled doubles like ancdist_conditional_lh_scaled
+ */
+double StateReconstructor::eval_likelihood_gradient (std::vector<mat>& grads) {
+    std::vector<RateModel *> models;
+    if (use_periods == true) {
+        for (unsigned int k=0; k < rm_periods.size(); k++) {
+            models.push_back(&rm_periods[k]);
+        }
+    } else {
+        models.push_back(&rm);
+    }
+    int nmodels = (int)models.size();
+    int nnodes = (int)nodes.size();
+    int root = nnodes - 1;
+    //which models have changed rates since the last call. what is kept from
+    //that call is only good for the segments of the ones that have not
+    std::vector<bool> changed(nmodels, true);
+    if ((int)grad_versions.size() != nmodels || (int)grad_valid.size() != nnodes) {
+        grad_versions.assign(nmodels, 0);
+        grad_valid.assign(nnodes, false);
+        grad_eigva.assign(nmodels, cx_vec());
+        grad_A.assign(nmodels, cx_mat());
+        grad_B.assign(nmodels, cx_mat());
+        grad_seg_ps.assign(nnodes, std::vector<mat>());
+        grad_below.assign(nnodes, std::vector<double>());
+        grad_inside.resize(nnodes, nstates);
+        grad_tops.resize(nnodes, nstates);
+        grad_lns.assign(nnodes, 0.0);
+    }
+    for (int k=0; k < nmodels; k++) {
+        unsigned long ver = models[k]->get_Q_version();
+        if (ver == grad_versions[k] && grad_eigva[k].n_elem > 0) {
+            changed[k] = false;
+        } else {
+            models[k]->get_eigensystem(grad_eigva[k], grad_A[k], grad_B[k]);
+        }
+        grad_versions[k] = ver;
+    }
+    const std::vector<cx_vec>& eigva = grad_eigva;
+    const std::vector<cx_mat>& A = grad_A;
+    const std::vector<cx_mat>& B = grad_B;
+    std::vector<cx_mat> H(nmodels);
+    for (int k=0; k < nmodels; k++) {
+        H[k] = cx_mat(nstates, nstates);
+        H[k].fill(0);
+    }
+    //the (model, duration) of each segment of a branch, from the node up
+    std::vector<std::vector<int> > seg_models(nnodes);
+    std::vector<std::vector<double> > seg_times(nnodes);
+    for (int r=0; r < root; r++) {
+        if (use_periods == true) {
+            std::vector<BranchSegment> * tsegs = nodes[r]->getSegVector();
+            for (unsigned int i=0; i < tsegs->size(); i++) {
+                seg_models[r].push_back(tsegs->at(i).getPeriod());
+                seg_times[r].push_back(tsegs->at(i).getDuration());
+            }
+        } else {
+            seg_models[r].push_back(0);
+            seg_times[r].push_back(nodes[r]->getBL());
+        }
+    }
+    //postorder: the conditionals at each node, at the bottom of each segment
+    //above it and at the top of its branch. a node is redone when it is new
+    //or a child's top moved; its branch from there, or else from the lowest
+    //segment in a changed model
+    LikelihoodWorkspace<double>& inside = grad_inside;
+    LikelihoodWorkspace<double>& tops = grad_tops;
+    std::vector<double>& lns = grad_lns;
+    std::vector<std::vector<mat> >& seg_ps = grad_seg_ps;
+    std::vector<bool> top_moved(nnodes, false);
+    std::vector<double> v(nstates);
+    for (int r=0; r < nnodes; r++) {
+        bool moved = (grad_valid[r] == false);
+        for (unsigned int s=0; s < children[r].size(); s++) {
+            if (top_moved[children[r][s]] == true) {
+                moved = true;
+            }
+        }
+        double * c = inside.row(r);
+        if (moved == true && children[r].empty()) {
+            for (int i=0; i < nstates; i++) {
+                if (use_periods == true) {
+                    c[i] = double(nodes[r]->getSegVector()->at(0).distconds->at(i));
+                } else {
+                    c[i] = scaled_conds.at(r, i);
+                }
+            }
+        } else if (moved == true) {
+            double lnscale = 0.0;
+            for (int i=0; i < nstates; i++) {
+                c[i] = 1.0;
+            }
+            for (unsigned int s=0; s < children[r].size(); s++) {
+                int crow = children[r][s];
+                lnscale += lns[crow];
+                for (int i=0; i < nstates; i++) {
+                    c[i] *= tops.at(crow, i);
+                }
+            }
+            double largest = 0.0;
+            for (int i=0; i < nstates; i++) {
+                largest = std::max(largest, c[i]);
+            }
+            if (largest > 0.0 && largest < SCALE_BELOW) {
+                for (int i=0; i < nstates; i++) {
+                    c[i] /= largest;
+                }
+                lnscale += log(largest);
+            }
+            lns[r] = lnscale;
+        }
+        if (r == root) {
+            grad_valid[r] = true;
+            continue;
+        }
+        int nsegs = (int)seg_models[r].size();
+        if (grad_valid[r] == false) {
+            seg_ps[r].assign(nsegs, mat(nstates, nstates));
+            grad_below[r].assign((size_t)nsegs * nstates, 0.0);
+        }
+        int start = nsegs;
+        for (int g=0; g < nsegs; g++) {
+            int m = seg_models[r][g];
+            if (grad_valid[r] == false || changed[m] == true) {
+                cx_mat p = models[m]->setup_P(seg_times[r][g], false, m);
+                for (int j=0; j < nstates; j++) {
+                    for (int k=0; k < nstates; k++) {
+                        seg_ps[r][g](j, k) = real(p(j, k));
+                    }
+                }
+                start = std::min(start, g);
+            }
+        }
+        double * below = &grad_below[r][0];
+        if (moved == true) {
+            start = 0;
+            for (int i=0; i < nstates; i++) {
+                below[i] = c[i];
+            }
+        }
+        for (int g=start; g < nsegs; g++) {
+            const mat& p = seg_ps[r][g];
+            const double * from = &below[(size_t)g * nstates];
+            double * to = (g + 1 < nsegs) ? &below[(size_t)(g + 1) * nstates] : &v[0];
+            for (int j=0; j < nstates; j++) {
+                double sum = 0.0;
+                for (int k=0; k < nstates; k++) {
+                    sum += p(j, k) * from[k];
+                }
+                to[j] = sum;
+            }
+        }
+        if (start < nsegs) {
+            double * top = tops.row(r);
+            for (int i=0; i < nstates; i++) {
+                top[i] = v[i];
+            }
+            top_moved[r] = true;
+        }
+        grad_valid[r] = true;
+    }
+    double totlike = 0.0;
+    for (int i=0; i < nstates; i++) {
+        totlike += inside.at(root, i);
+    }
+    double lnl = log(totlike) + lns[root];
+    //preorder: the outside vector of each branch, walked down its segments
+    LikelihoodWorkspace<double> outside;
+    outside.resize(nnodes, nstates, 1.0);
+    std::vector<double> olns(nnodes, 0.0);
+    std::vector<double> o(nstates);
+    std::vector<double> w(nstates);
+    std::vector<cx_double> ao(nstates);
+    std::vector<cx_double> bc(nstates);
+    std::vector<cx_double> ex(nstates);
+    for (int r=root-1; r >= 0; r--) {
+        int par = parents[r];
+        double ln = olns[par];
         for (int i=0; i < nstates; i++) {
-            revconds->at(i) = 1.0;//prior
+            o[i] = outside.at(par, i);
         }
-        node->assocObject(revB,*revconds);
-        delete revconds;
-        for (int i = 0; i < node->getChildCount(); i++) {
-            reverse(node->getChild(i));
+        for (unsigned int s=0; s < children[par].size(); s++) {
+            int srow = children[par][s];
+            if (srow != r) {
+                ln += lns[srow];
+                for (int i=0; i < nstates; i++) {
+                    o[i] *= tops.at(srow, i);
+                }
+            }
+        }
+        double largest = 0.0;
+        for (int i=0; i < nstates; i++) {
+            largest = std::max(largest, o[i]);
+        }
+        if (largest > 0.0) {
+            for (int i=0; i < nstates; i++) {
+                o[i] /= largest;
+            }
+            ln += log(largest);
+        }
+        //the conditionals below each segment, from the postorder pass
+        int nsegs = (int)seg_ps[r].size();
+        const double * below = &grad_below[r][0];
+        double weight = exp(ln + lns[r] - lnl);
+        for (int g=nsegs-1; g >= 0; g--) {
+            int m = seg_models[r][g];
+            double t = seg_times[r][g];
+            const cx_mat& a = A[m];
+            const cx_mat& b = B[m];
+            for (int k=0; k < nstates; k++) {
+                ao[k] = 0.0;
+                bc[k] = 0.0;
+                for (int i=0; i < nstates; i++) {
+                    ao[k] += a(i, k) * o[i];
+                    bc[k] += b(k, i) * below[(size_t)g * nstates + i];
+                }
+                ex[k] = exp(eigva[m](k) * t);
+            }
+            for (int k=0; k < nstates; k++) {
+                for (int l=0; l < nstates; l++) {
+                    H[m](k, l) += weight * ao[k] * bc[l]
+                        * exp_difference(eigva[m](k), eigva[m](l), ex[k], ex[l], t);
+                }
+            }
+            //carry the outside vector down through this segment
+            const mat& p = seg_ps[r][g];
+            for (int j=0; j < nstates; j++) {
+                w[j] = 0.0;
+                for (int i=0; i < nstates; i++) {
+                    w[j] += o[i] * p(i, j);
+                }
+            }
+            o.swap(w);
+        }
+        for (int i=0; i < nstates; i++) {
+            outside.at(r, i) = o[i];
+        }
+        olns[r] = ln;
+    }
+    //dlnL/dQ = B'HA', less the diagonal for each row
+    grads.assign(nmodels, mat(nstates, nstates));
+    cx_mat T(nstates, nstates);
+    for (int m=0; m < nmodels; m++) {
+        for (int k=0; k < nstates; k++) {
+            for (int j=0; j < nstates; j++) {
+                T(k, j) = 0.0;
+                for (int l=0; l < nstates; l++) {
+                    T(k, j) += H[m](k, l) * A[m](j, l);
+                }
+            }
+        }
+        for (int i=0; i < nstates; i++) {
+            std::vector<double> row(nstates, 0.0);
+            for (int j=0; j < nstates; j++) {
+                cx_double mij = 0.0;
+                for (int k=0; k < nstates; k++) {
+                    mij += B[m](k, i) * T(k, j);
+                }
+                row[j] = real(mij);
+            }
+            for (int j=0; j < nstates; j++) {
+                grads[m](i, j) = (i == j) ? 0.0 : -(row[j] - row[i]);
+            }
+        }
+    }
+    return -lnl;
+}
+
+
+void StateReconstructor::prepare_ancstate_reverse () {
+    reverse();
+}
+
+
+/*
+ * preorder pass (the rows backwards) for the reverse conditionals (B) of
+ * each node, and the B's for the stochastic mapping when those are set up
+ */
+void StateReconstructor::reverse () {
+    rev = true;
+    int nnodes = (int)nodes.size();
+    if (stochastic == true && stoch_revB_time.get_num_nodes() != nnodes) {
+        stoch_revB_time.resize(nnodes, nstates);
+        stoch_revB_number.resize(nnodes, nstates);
+    }
+    std::vector<Superdouble> tempA(nstates, 0);
+    std::vector<Superdouble> tempmoveAer(nstates, 0);
+    std::vector<Superdouble> tempmoveAen(nstates, 0);
+    for (int r=nnodes-1; r >= 0; r--) {
+        Superdouble * revconds = revB.row(r);
+        if (parents[r] < 0) {
+            for (int i=0; i < nstates; i++) {
+                revconds[i] = 1.0;//prior
+            }
+            continue;
         }
-    } else {
-        //else if (node.isExternal() == false) {
         //calculate A i
         //sum over all alpha k of sister node of the parent times the priors of the speciations
         //(weights) times B of parent j
-        VectorNodeObject<Superdouble> * parrev = ((VectorNodeObject<Superdouble>*)node->getParent()->getObject(revB));
-        VectorNodeObject<Superdouble> sisdistconds;
-        if (node->getParent()->getChild(0) != node) {
-            VectorNodeObject<Superdouble>* talph = ((VectorNodeObject<Superdouble>*) node->getParent()->getChild(0)->getObject(alphas));
-            sisdistconds = *talph;
-        } else {
-            VectorNodeObject<Superdouble>* talph = ((VectorNodeObject<Superdouble>*) node->getParent()->getChild(1)->getObject(alphas));
-            sisdistconds = *talph;
-        }
-
-        VectorNodeObject<Superdouble> tempA(nstates, 0);
+        int par = parents[r];
+        Superdouble * parrev = revB.row(par);
         //needs to be the same as ancdist_cond_lh
         for (int i = 0; i < nstates; i++) {
             //root has i, curnode has left, sister of cur has right
-            //for (int j = 0; j < nstates; j++) {
-            tempA[i] += (sisdistconds.at(i)*parrev->at(i));
-            //}
+            tempA[i] = parrev[i];
+            for (unsigned int s=0; s < children[par].size(); s++) {
+                if (children[par][s] != r) {
+                    tempA[i] = alphas.at(children[par][s], i) * tempA[i];
+                }
+            }
         }
         //now calculate node B
-        //VectorNodeObject<BranchSegment>* tsegs = ((VectorNodeObject<BranchSegment>*) node.getObject(seg));
         for (int j=0; j < nstates; j++) {
-            revconds->at(j) = 0;
+            revconds[j] = 0;
         }
-        //RateModel * rm = tsegs->at(ts).getModel();
-        cx_mat * p = &rm.stored_p_matrices[node->getBL()];
+        cx_mat * p = &rm.stored_p_matrices[nodes[r]->getBL()];
         mat * EN = NULL;
         mat * ER = NULL;
-        VectorNodeObject<Superdouble> tempmoveAer(tempA);
-        VectorNodeObject<Superdouble> tempmoveAen(tempA);
         if (stochastic == true) {
             //initialize the segment B's
             for (int j=0; j < nstates; j++) {
                 tempmoveAer[j] = 0;
                 tempmoveAen[j] = 0;
             }
-            EN = &stored_EN_matrices[node->getBL()];
-            ER = &stored_ER_matrices[node->getBL()];
+            EN = &stored_EN_matrices[r];
+            ER = &stored_ER_matrices[r];
         }
         for (int j=0; j < nstates; j++) {
             for (int i = 0; i < nstates; i++) {
-                revconds->at(j) += tempA[i]*real((*p)(i, j));//tempA needs to change each time
+                revconds[j] += tempA[i]*real((*p)(i, j));//tempA needs to change each time
                 if (stochastic == true) {
                     tempmoveAer[j] += tempA[i]*(((*ER)(i, j)));
                     tempmoveAen[j] += tempA[i]*(((*EN)(i, j)));
                 }
             }
         }
-        for (int j=0; j < nstates; j++) {
-            tempA[j] = revconds->at(j);
-        }
         if (stochastic == true) {
-            node->seg_sp_stoch_map_revB_time = tempmoveAer;
-            node->seg_sp_stoch_map_revB_number = tempmoveAen;
-        }
-        node->assocObject(revB,*revconds); // leak
-        delete revconds;
-        for (int i = 0; i < node->getChildCount(); i++) {
-            reverse(node->getChild(i));
+            for (int j=0; j < nstates; j++) {
+                stoch_revB_time.at(r, j) = tempmoveAer[j];
+                stoch_revB_number.at(r, j) = tempmoveAen[j];
+            }
         }
     }
 }
@@ -427,17 +894,14 @@ void StateReconstructor::reverse (Node * node) {
 std::vector<Superdouble> StateReconstructor::calculate_ancstate_reverse_sd (Node& node) {
     std::vector<Superdouble> LHOODS(nstates, 0);
     if (node.isExternal() == false) {//is not a tip
-        VectorNodeObject<Superdouble> * Bs = (VectorNodeObject<Superdouble> *) node.getObject(revB);
-        Node * c1 = node.getChild(0);
-        Node * c2 = node.getChild(1);
-        VectorNodeObject<Superdouble>* v1  = ((VectorNodeObject<Superdouble>*) c1->getObject(alphas));
-        VectorNodeObject<Superdouble>* v2 = ((VectorNodeObject<Superdouble>*) c2->getObject(alphas));
-
+        int row = get_row(node);
+        Superdouble * Bs = revB.row(row);
         for (int i = 0; i < nstates; i++) {
-            //for (int j=0; j < nstates; j++) {
-            //  LHOODS[i] += (v1->at(i)*v2->at(j));//*weight);
-            //}
-            LHOODS[i] = ((v1->at(i)*v2->at(i)) * Bs->at(i));
+            Superdouble lh = alphas.at(children[row][0], i);
+            for (unsigned int c=1; c < children[row].size(); c++) {
+                lh = lh * alphas.at(children[row][c], i);
+            }
+            LHOODS[i] = lh * Bs[i];
         }
     }
     return LHOODS;
@@ -445,194 +909,159 @@ std::vector<Superdouble> StateReconstructor::calculate_ancstate_reverse_sd (Node
 
 
 std::vector<double> StateReconstructor::calculate_ancstate_reverse (Node& node) {
+    std::vector<Superdouble> lhoods = calculate_ancstate_reverse_sd(node);
     std::vector<double> LHOODS(nstates, 0);
-    if (node.isExternal() == false) {//is not a tip
-        VectorNodeObject<Superdouble> * Bs = (VectorNodeObject<Superdouble> *) node.getObject(revB);
-        Node * c1 = node.getChild(0);
-        Node * c2 = node.getChild(1);
-        VectorNodeObject<Superdouble>* v1  = ((VectorNodeObject<Superdouble>*) c1->getObject(alphas));
-        VectorNodeObject<Superdouble>* v2 = ((VectorNodeObject<Superdouble>*) c2->getObject(alphas));
+    for (int i = 0; i < nstates; i++) {
+        LHOODS[i] = double(lhoods[i]);
+    }
+    return LHOODS;
+}
 
-        for (int i = 0; i < nstates; i++) {
-            //for (int j=0; j < nstates; j++) {
-            //  LHOODS[i] += (v1->at(i)*v2->at(j));//*weight);
-            //}
-            LHOODS[i] = double((v1->at(i)*v2->at(i)) * Bs->at(i));
+
+/*
+ * integral over the branch of exp(li s) exp(lj (dur-s)) ds
+ */
+static inline cx_double stochmap_integral (const cx_double& li, const cx_double& lj,
+        const double& dur, const bool& isImag) {
+    cx_double dij = (li-lj) * dur;
+    cx_double Iijt = 0;
+    if (abs(dij) > 10) {
+        Iijt = (exp(li*dur)-exp(lj*dur))/(li-lj);
+    } else if (abs(dij) < 10e-20) {
+        Iijt = dur*exp(lj*dur)*(1.+dij/2.+pow(dij, 2.)/6.+pow(dij, 3.)/24.);
+    } else {
+        if (li == lj) {
+            //WAS Iijt = dur*exp(lj*dur)*expm1(dij)/dij;
+            if (isImag) {
+                Iijt = dur*exp(lj*dur)*(exp(dij)-1.)/dij;
+            } else {
+                Iijt = dur*exp(lj*dur)*(expm1(real(dij)))/dij;
+            }
+        } else {
+            //WAS Iijt = -dur*exp(li*dur)*expm1(-dij)/dij;
+            if (isImag) {
+                Iijt = -dur*exp(li*dur)*(exp(-dij)-1.)/dij;
+            } else {
+                Iijt = -dur*exp(li*dur)*(expm1(real(-dij)))/dij;
+            }
         }
     }
-    return LHOODS;
+    return Iijt;
 }
 
 
-void StateReconstructor::prepare_stochmap_reverse_all_nodes (int from, int to) {
+/*
+ * the local expectation matrices of every branch: the number of changes
+ * counted by Ql (EN) and the time spent in the states weighted by W (ER).
+ * with Q = A diag(l) B, sum_ij Si M Sj Iij (Si = A Ei B) is A (I o BMA) B,
+ * so one eigensystem and one BMA product serve all branches, and branches
+ * of the same length share the result. stored by node row
+ */
+void StateReconstructor::prepare_stochmap (const mat& Ql, const mat& W) {
     stochastic = true;
-    //calculate and store local expectation matrix for each branch length
-    for (int k = 0; k < tree->getNodeCount(); k++) {
-        double dur =  tree->getNode(k)->getBL();
-        cx_mat eigvec(nstates, nstates); eigvec.fill(0);
-        cx_mat eigval(nstates, nstates); eigval.fill(0);
-        bool isImag = rm.get_eigenvec_eigenval_from_Q(&eigval, &eigvec);
-        mat Ql(nstates, nstates);Ql.fill(0); Ql(from, to) = rm.get_Q()(from, to);
-        mat W(nstates, nstates);W.fill(0); W(from, from) = 1;
-        cx_mat summed(nstates, nstates); summed.fill(0);
-        cx_mat summedR(nstates, nstates); summedR.fill(0);
+    cx_vec eigva;
+    cx_mat A;
+    cx_mat B;
+    rm.get_eigensystem(eigva, A, B);
+    bool isImag = false;
+    for (int i=0; i < nstates; i++) {
+        if (imag(eigva(i)) != 0) {
+            isImag = true;
+        }
+        for (int j=0; j < nstates; j++) {
+            if (imag(A(i, j)) != 0) {
+                isImag = true;
+            }
+        }
+    }
+    cx_mat KN = B * Ql * A;
+    cx_mat KR = B * W * A;
+    int nnodes = (int)nodes.size();
+    stored_EN_matrices.assign(nnodes, mat(nstates, nstates));
+    stored_ER_matrices.assign(nnodes, mat(nstates, nstates));
+    std::unordered_map<double, int> done;
+    cx_mat IN(nstates, nstates);
+    cx_mat IR(nstates, nstates);
+    for (int r=0; r < nnodes; r++) {
+        double dur = nodes[r]->getBL();
+        std::unordered_map<double, int>::const_iterator it = done.find(dur);
+        if (it != done.end()) {
+            stored_EN_matrices[r] = stored_EN_matrices[it->second];
+            stored_ER_matrices[r] = stored_ER_matrices[it->second];
+            continue;
+        }
+        done[dur] = r;
         for (int i=0; i < nstates; i++) {
-            mat Ei(nstates, nstates); Ei.fill(0);Ei(i, i)=1;
-            cx_mat Si(nstates, nstates);
-            Si = eigvec * Ei * inv(eigvec);
             for (int j=0; j < nstates; j++) {
-                cx_double dij = (eigval(i, i)-eigval(j, j)) * dur;
-                mat Ej(nstates, nstates); Ej.fill(0); Ej(j, j)=1;
-                cx_mat Sj(nstates, nstates);
-                Sj = eigvec * Ej * inv(eigvec);
-                cx_double Iijt = 0;
-                if (abs(dij) > 10) {
-                    Iijt = (exp(eigval(i, i)*dur)-exp(eigval(j, j)*dur))/(eigval(i, i)-eigval(j, j));
-                } else if (abs(dij) < 10e-20) {
-                    Iijt = dur*exp(eigval(j, j)*dur)*(1.+dij/2.+pow(dij, 2.)/6.+pow(dij, 3.)/24.);
-                } else {
-                    if (eigval(i, i) == eigval(j, j)) {
-                        //WAS Iijt = dur*exp(eigval(j, j)*dur)*expm1(dij)/dij;
-                        if (isImag) {
-                            Iijt = dur*exp(eigval(j, j)*dur)*(exp(dij)-1.)/dij;
-                        } else {
-                            Iijt = dur*exp(eigval(j, j)*dur)*(expm1(real(dij)))/dij;
-                        }
-                    } else {
-                        //WAS Iijt = -dur*exp(eigval(i, i)*dur)*expm1(-dij)/dij;
-                        if (isImag) {
-                            Iijt = -dur*exp(eigval(i, i)*dur)*(exp(-dij)-1.)/dij;
-                        } else {
-                            Iijt = -dur*exp(eigval(i, i)*dur)*(expm1(real(-dij)))/dij;
-                        }
-                    }
-                }
-                summed += (Si  * Ql * Sj * Iijt);
-                summedR += (Si * W * Sj * Iijt);
+                cx_double Iijt = stochmap_integral(eigva(i), eigva(j), dur, isImag);
+                IN(i, j) = Iijt * KN(i, j);
+                IR(i, j) = Iijt * KR(i, j);
             }
         }
-        //std::cout << isImag << std::endl;
-        //std::cout << summed << std::endl;
+        cx_mat summed = A * IN * B;
+        cx_mat summedR = A * IR * B;
         //seems like when these are IMAG, there can sometimes be negative with very small values
-        stored_EN_matrices[dur] = abs(real(summed)); //(real(summed));
-        stored_ER_matrices[dur] = abs(real(summedR)); //(real(summedR));
+        mat& EN = stored_EN_matrices[r];
+        mat& ER = stored_ER_matrices[r];
+        for (int i=0; i < nstates; i++) {
+            for (int j=0; j < nstates; j++) {
+                EN(i, j) = fabs(real(summed(i, j)));
+                ER(i, j) = fabs(real(summedR(i, j)));
+            }
+        }
     }
 }
 
 
+void StateReconstructor::prepare_stochmap_reverse_all_nodes (int from, int to) {
+    mat Ql(nstates, nstates); Ql.fill(0); Ql(from, to) = rm.get_Q()(from, to);
+    mat W(nstates, nstates); W.fill(0); W(from, from) = 1;
+    prepare_stochmap(Ql, W);
+}
+
+
 /*
  * only for number of changes
 */
 void StateReconstructor::prepare_stochmap_reverse_all_nodes_all_matrices () {
-    stochastic = true;
-    //calculate and store local expectation matrix for each branch length
-    for (int k = 0; k < tree->getNodeCount(); k++) {
-        double dur =  tree->getNode(k)->getBL();
-        cx_mat eigvec(nstates, nstates);eigvec.fill(0);
-        cx_mat eigval(nstates, nstates);eigval.fill(0);
-        bool isImag = rm.get_eigenvec_eigenval_from_Q(&eigval, &eigvec);
-        mat Ql(nstates, nstates);
-        Ql.fill(0);
-        for (unsigned int i=0; i < Ql.n_rows; i++) {
-            for (unsigned int j=0; j < Ql.n_cols; j++) {
-                if (i != j) {
-                    Ql(i, j) = rm.get_Q()(i, j);
-                }
-            }
-        }
-        mat W(nstates, nstates); W.fill(0); W(1, 1) = 1;
-        cx_mat summed(nstates, nstates); summed.fill(0);
-        cx_mat summedR(nstates, nstates); summedR.fill(0);
-        for (int i=0; i < nstates; i++) {
-            mat Ei(nstates, nstates);Ei.fill(0);Ei(i, i)=1;
-            cx_mat Si(nstates, nstates);
-            Si = eigvec * Ei * inv(eigvec);
-            for (int j=0; j < nstates; j++) {
-                cx_double dij = (eigval(i, i)-eigval(j, j)) * dur;
-                mat Ej(nstates, nstates);Ej.fill(0);Ej(j, j)=1;
-                cx_mat Sj(nstates, nstates);
-                Sj = eigvec * Ej * inv(eigvec);
-                cx_double Iijt = 0;
-                if (abs(dij) > 10) {
-                    Iijt = (exp(eigval(i, i)*dur)-exp(eigval(j, j)*dur))/(eigval(i, i)-eigval(j, j));
-                } else if (abs(dij) < 10e-20) {
-                    Iijt = dur*exp(eigval(j, j)*dur)*(1.+dij/2.+pow(dij, 2.)/6.+pow(dij, 3.)/24.);
-                } else {
-                    if (eigval(i, i) == eigval(j, j)) {
-                        //WAS Iijt = dur*exp(eigval(j, j)*dur)*expm1(dij)/dij;
-                        if (isImag) {
-                            Iijt = dur*exp(eigval(j, j)*dur)*(exp(dij)-1.)/dij;
-                        } else {
-                            Iijt = dur*exp(eigval(j, j)*dur)*(expm1(real(dij)))/dij;
-                        }
-                    } else {
-                        //WAS Iijt = -dur*exp(eigval(i, i)*dur)*expm1(-dij)/dij;
-                        if (isImag) {
-                            Iijt = -dur*exp(eigval(i, i)*dur)*(exp(-dij)-1.)/dij;
-                        } else {
-                            Iijt = -dur*exp(eigval(i, i)*dur)*(expm1(real(-dij)))/dij;
-                        }
-                    }
-                }
-                summed += (Si  * Ql * Sj * Iijt);
-                summedR += (Si * W * Sj * Iijt);
+    mat Ql(nstates, nstates);
+    Ql.fill(0);
+    for (unsigned int i=0; i < Ql.n_rows; i++) {
+        for (unsigned int j=0; j < Ql.n_cols; j++) {
+            if (i != j) {
+                Ql(i, j) = rm.get_Q()(i, j);
             }
         }
-        //std::cout << isImag << std::endl;
-        //std::cout << summed << std::endl;
-        //seems like when these are IMAG, there can sometimes be negative with very small values
-        stored_EN_matrices[dur] = abs(real(summed));//(real(summed));
-        stored_ER_matrices[dur] = abs(real(summedR));;//(real(summedR));
     }
+    mat W(nstates, nstates); W.fill(0); W(1, 1) = 1;
+    prepare_stochmap(Ql, W);
 }
 
 
 std::vector<double> StateReconstructor::calculate_reverse_stochmap (Node& node, bool tm) {
+    int row = get_row(node);
+    Superdouble * Bs;
+    if (tm) {
+        Bs = stoch_revB_time.row(row);
+    } else {
+        Bs = stoch_revB_number.row(row);
+    }
+    std::vector<double> totalExp(nstates, 0);
     if (node.isExternal()==false) {//is not a tip
-        std::vector<double> totalExp(nstates, 0);
-        std::vector<Superdouble> Bs;
-        if (tm) {
-            Bs = node.seg_sp_stoch_map_revB_time;
-        } else {
-            Bs =  node.seg_sp_stoch_map_revB_number;
-        }
-        Node * c1 = node.getChild(0);
-        Node * c2 = node.getChild(1);
-        VectorNodeObject<Superdouble> * v1 = ((VectorNodeObject<Superdouble>*) c1->getObject(alphas));
-        VectorNodeObject<Superdouble> * v2 = ((VectorNodeObject<Superdouble>*) c2->getObject(alphas));
-        VectorNodeObject<double> LHOODS(nstates, 0);
         for (int i = 0; i < nstates; i++) {
-            //for (int j=0; j < nstates; j++) {
-            //int ind1 = leftdists[j];
-            //int ind2 = rightdists[j];
-            //LHOODS[i] += (v1.at(ind1)*v2.at(ind2)*weight);
-            //}
-            LHOODS[i] = double(v1->at(i) * v2->at(i) * Bs.at(i));
-            //std::cout << v1->at(i) << " " <<  v2->at(i)<< " " << Bs.at(i) << std::endl;
-        }
-        for (int i=0; i < nstates; i++) {
-            totalExp[i] = LHOODS[i];
-        }
-        //not sure if this should return a Superdouble or not when doing a bigtree
-        return totalExp;
-    } else { // hmm don't really need this else
-        std::vector<double> totalExp(nstates, 0);
-        std::vector<Superdouble> Bs;
-        if (tm) {
-            Bs = node.seg_sp_stoch_map_revB_time;
-        } else {
-            Bs =  node.seg_sp_stoch_map_revB_number;
+            Superdouble lh = alphas.at(children[row][0], i);
+            for (unsigned int c=1; c < children[row].size(); c++) {
+                lh = lh * alphas.at(children[row][c], i);
+            }
+            //not sure if this should return a Superdouble or not when doing a bigtree
+            totalExp[i] = double(lh * Bs[i]);
         }
-        VectorNodeObject<double> LHOODS(nstates, 0);
-        VectorNodeObject<Superdouble>* distconds = ((VectorNodeObject<Superdouble>*) node.getObject(dc));
+    } else {
         for (int i = 0; i < nstates; i++) {
-            LHOODS[i] = double(Bs.at(i) * (distconds->at(i) ));
-        }
-        for (int i=0; i < nstates; i++) {
-            totalExp[i] = LHOODS[i];
+            totalExp[i] = double(Bs[i] * conds.at(row, i));
         }
-        return totalExp;
     }
+    return totalExp;
 }
 
 
@@ -646,6 +1075,11 @@ void StateReconstructor::set_use_stored_matrices (bool i) {
 }
 
 
+void StateReconstructor::set_use_scaled_likelihood (bool i) {
+    use_scaled = i;
+}
+
+
 StateReconstructor::~StateReconstructor () {
 
 }
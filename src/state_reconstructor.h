@@ -1,13 +1,15 @@
 #ifndef _STATE_RECONSTRUCTOR_H_
 #define _STATE_RECONSTRUCTOR_H_
 
+#include <iostream>
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include "rate_model.h"
 #include "superdouble.h"
-#include "vector_node_object.h"
+#include "likelihood_workspace.h"
 
 class Sequence; // forward declaration
 class Node; // forward declaration
@@ -23,41 +25,78 @@ private:
     int nstates;
     RateModel& rm;
     std::vector<RateModel>& rm_periods;
-    std::string dc;
-    std::string andc;
     bool store_p_matrices;
     bool use_stored_matrices;
+    bool use_scaled;
+    
+    //nodes get a row in each workspace, in postorder (the root is last)
+    std::vector<Node *> nodes;
+    std::vector<int> parents;
+    std::vector<std::vector<int> > children;
+    std::unordered_map<Node *, int> node_rows;
+    LikelihoodWorkspace<Superdouble> conds; //at the node, the data for tips
+    LikelihoodWorkspace<Superdouble> alphas; //at the top of the branch above the node
+    LikelihoodWorkspace<double> scaled_conds;
+    std::vector<double> scaled_lns;
+    
+    //periods: the rate revisions seen by the last pass, and whether the
+    //conditionals carried up each node's branch are still good
+    std::vector<unsigned long> period_versions;
+    std::vector<bool> period_alpha_valid;
+    LikelihoodWorkspace<Superdouble> period_alphas;
+    
+    //the gradient pass keeps the same for itself: the eigensystems and
+    //segment P's of each model, and the scaled conditionals at the node,
+    //below each segment and at the top of each branch
+    std::vector<unsigned long> grad_versions;
+    std::vector<bool> grad_valid;
+    std::vector<cx_vec> grad_eigva;
+    std::vector<cx_mat> grad_A;
+    std::vector<cx_mat> grad_B;
+    std::vector<std::vector<mat> > grad_seg_ps;
+    std::vector<std::vector<double> > grad_below;
+    LikelihoodWorkspace<double> grad_inside;
+    LikelihoodWorkspace<double> grad_tops;
+    std::vector<double> grad_lns;
     
     //reverse bits
-    std::string revB;
+    LikelihoodWorkspace<Superdouble> revB;
     bool rev;
     //end reverse bits
     
     //stochastic mapping bits
-    std::string rev_exp_number;
-    std::string rev_exp_time;
+    LikelihoodWorkspace<Superdouble> stoch_revB_time;
+    LikelihoodWorkspace<Superdouble> stoch_revB_number;
     bool stochastic;
-    //map of period int and then branch length double
-    std::map<Superdouble, mat > stored_EN_matrices;
-    std::map<Superdouble, mat > stored_ER_matrices;
+    //local expectation matrices of the branch above each node row
+    std::vector<mat> stored_EN_matrices;
+    std::vector<mat> stored_ER_matrices;
     //end mapping bits
-    std::string sp_alphas;
-    std::string alphas;
     
-    VectorNodeObject<Superdouble> conditionals (Node& node);
-    VectorNodeObject<Superdouble> conditionals_periods (Node& node);
-    void ancdist_conditional_lh (Node& node);
+    std::ostream * logs;
+    
+    int get_row (Node& node) const;
+    void conditionals (const int& row, std::vector<Superdouble>& v);
+    std::vector<Superdouble> conditionals_periods (Node& node, const unsigned int& start=0);
+    std::vector<bool> changed_periods ();
+    unsigned int first_changed_segment (const int& row, const std::vector<bool>& changed);
+    void invalidate_periods ();
+    void ancdist_conditional_lh ();
+    double ancdist_conditional_lh_scaled ();
+    void reverse ();
+    void prepare_stochmap (const mat& Ql, const mat& W);
     
 public:
     StateReconstructor (RateModel&, std::vector<RateModel>& _vrm);
-    void set_periods (std::vector<double>& ps, std::vector<RateModel>& rms);
+    void set_log_stream (std::ostream * los);
+    void set_periods (const std::vector<double>& ps, std::vector<RateModel>& rms);
     void set_tree (Tree *);
     double eval_likelihood ();
+    double eval_likelihood_gradient (std::vector<mat>& grads);
     void set_periods_model ();
     bool set_tip_conditionals (std::vector<Sequence>& distrib_data);
     bool set_tip_conditionals_already_given (std::vector<Sequence>& distrib_data);
     void prepare_ancstate_reverse ();
-    void reverse (Node *);
     std::vector<Superdouble> calculate_ancstate_reverse_sd (Node& node);
     std::vector<double> calculate_ancstate_reverse (Node& node);
     void prepare_stochmap_reverse_all_nodes (int, int);
@@ -65,6 +104,7 @@ public:
     std::vector<double> calculate_reverse_stochmap (Node&, bool);
     void set_store_p_matrices (bool i);
     void set_use_stored_matrices (bool i);
+    void set_use_scaled_likelihood (bool i);
     ~StateReconstructor ();
 };
 
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <algorithm>
 #include <assert.h>
 
 #include "node.h"
@@ -41,9 +42,19 @@ Node * Tree::getExternalNode (int num) {
 
 
 /*
- * could precompute this, check for run time differences
+ * names are looked up in a map built on first use. tips may have been renamed
+ * since, so a miss (or a stale hit) falls back to the full search
  */
 Node * Tree::getExternalNode (std::string name) {
+    if (externalNameMap.empty()) {
+        for (int i=0; i < externalNodeCount; i++) {
+            externalNameMap[externalNodes[i]->getName()] = externalNodes[i];
+        }
+    }
+    std::unordered_map<std::string, Node *>::const_iterator it = externalNameMap.find(name);
+    if (it != externalNameMap.end() && it->second->getName() == name) {
+        return it->second;
+    }
     Node * ret = NULL;
     for (int i=0; i < externalNodeCount; i++) {
         if (externalNodes.at(i)->getName() == name) {
@@ -135,6 +146,7 @@ Node * Tree::getRoot () {
 
 void Tree::setRoot (Node * inroot) {
     root = inroot;
+    invalidateLCAIndex();
 }
 
 
@@ -269,6 +281,7 @@ void Tree::duplicateRootSupport () {
  * seems to be working now
  */
 void Tree::tritomyRoot (Node * toberoot) {
+    invalidateLCAIndex();
     Node * curroot = this->getRoot();
     if (toberoot == NULL) {
         if (curroot->getChild(0)->isInternal()) {
@@ -315,48 +328,90 @@ void Tree::tritomyRoot (Node * toberoot) {
 
 
 Node * Tree::getMRCA (std::vector<std::string> innodes) {
-    Node * mrca = NULL;
-    if (innodes.size() == 1) {
-        return this->getExternalNode(innodes[0]);
-    } else {
-        std::vector<std::string> outgroup;
-        for (unsigned int i=0; i < innodes.size(); i++) {
-            outgroup.push_back(innodes.at(i));
-        }
-        Node * cur1 = this->getExternalNode(outgroup.at(0));
-        outgroup.erase(outgroup.begin());
-        Node * cur2 = NULL;
-        Node * tempmrca = NULL;
-        while (outgroup.size() > 0) {
-            cur2 = this->getExternalNode(outgroup.at(0));
-            outgroup.erase(outgroup.begin());
-            tempmrca = getMRCATraverse(cur1, cur2);
-            cur1 = tempmrca;
-        }
-        mrca = cur1;
+    std::vector<Node *> nds;
+    for (unsigned int i=0; i < innodes.size(); i++) {
+        nds.push_back(this->getExternalNode(innodes[i]));
     }
-    return mrca;
+    return getMRCA(nds);
 }
 
 
+/*
+ * the mrca of a set of nodes is the shallowest node in the euler tour between
+ * the first and last of them to be visited, so this is O(k) once the index is
+ * built. nodes that are not in the index (the tree was edited without
+ * invalidateLCAIndex) are handled by walking the parents as before. building
+ * the index writes to the tree, so queries on a tree shared between threads
+ * need to be serialized by the caller
+ */
 Node * Tree::getMRCA (std::vector<Node *> innodes) {
-    Node * mrca = NULL;
+    if (innodes.empty()) {
+        return NULL;
+    }
+    for (unsigned int i=0; i < innodes.size(); i++) {
+        if (innodes[i] == NULL) {
+            return NULL;
+        }
+    }
     if (innodes.size() == 1) {
         return innodes[0];
-    } else {
-        Node * cur1 = innodes.at(0);
-        innodes.erase(innodes.begin());
-        Node * cur2 = NULL;
-        Node * tempmrca = NULL;
-        while (innodes.size() > 0) {
-            cur2 = innodes.at(0);
-            innodes.erase(innodes.begin());
-            tempmrca = getMRCATraverse(cur1, cur2);
-            cur1 = tempmrca;
+    }
+    if (!lcaIndexed) {
+        buildLCAIndex();
+    }
+    int from = -1;
+    int to = -1;
+    for (unsigned int i=0; i < innodes.size(); i++) {
+        std::unordered_map<Node *, int>::const_iterator it = firstVisit.find(innodes[i]);
+        if (it == firstVisit.end()) {
+            Node * mrca = innodes[0];
+            for (unsigned int j=1; j < innodes.size(); j++) {
+                mrca = getMRCATraverse(mrca, innodes[j]);
+            }
+            return mrca;
+        }
+        if (from == -1 || it->second < from) {
+            from = it->second;
+        }
+        if (it->second > to) {
+            to = it->second;
         }
-        mrca = cur1;
     }
-    return mrca;
+    return eulerTour[getShallowestInTour(from, to)];
+}
+
+
+// O(1) once the index is built
+Node * Tree::getMRCA (Node * nd1, Node * nd2) {
+    if (nd1 == NULL || nd2 == NULL) {
+        return NULL;
+    }
+    if (!lcaIndexed) {
+        buildLCAIndex();
+    }
+    std::unordered_map<Node *, int>::const_iterator it1 = firstVisit.find(nd1);
+    std::unordered_map<Node *, int>::const_iterator it2 = firstVisit.find(nd2);
+    if (it1 == firstVisit.end() || it2 == firstVisit.end()) {
+        return getMRCATraverse(nd1, nd2);
+    }
+    int from = std::min(it1->second, it2->second);
+    int to = std::max(it1->second, it2->second);
+    return eulerTour[getShallowestInTour(from, to)];
+}
+
+
+/*
+ * drop the lca index. this is done by processRoot and the topology edits
+ * here; call it after editing the nodes of a tree directly (with
+ * Node::addChild/removeChild)
+ */
+void Tree::invalidateLCAIndex () {
+    lcaIndexed = false;
+    eulerTour.clear();
+    eulerDepth.clear();
+    firstVisit.clear();
+    sparseTable.clear();
+    externalNameMap.clear();
 }
 
 
@@ -433,6 +488,7 @@ void Tree::processRoot () {
     externalNodes.clear();
     internalNodeCount = 0;
     externalNodeCount = 0;
+    invalidateLCAIndex();
     if (&root == NULL) {
         return;
     }
@@ -479,6 +535,7 @@ void Tree::exchangeNodes (Node * node1, Node * node2) {
     assert(bp2);
     par1->addChild(*node2);
     par2->addChild(*node1);
+    invalidateLCAIndex();
 }
 
 
@@ -613,6 +670,65 @@ Node * Tree::getMRCATraverse (Node * curn1, Node * curn2) {
 }
 
 
+/*
+ * euler tour (each node is listed on entry and again after each child) with
+ * the depth of each entry, and a sparse table where sparseTable[k][i] is the
+ * position of the shallowest entry in [i, i + 2^k). O(n log n) to build
+ */
+void Tree::buildLCAIndex () {
+    eulerTour.clear();
+    eulerDepth.clear();
+    firstVisit.clear();
+    sparseTable.clear();
+    if (root == NULL) {
+        return;
+    }
+    // iterative, as ladder-like trees can be very deep
+    std::vector<std::pair<Node *, int> > stack;
+    stack.push_back(std::make_pair(root, 0));
+    while (!stack.empty()) {
+        Node * nd = stack.back().first;
+        int next = stack.back().second;
+        if (next == 0) {
+            firstVisit[nd] = (int)eulerTour.size();
+        }
+        eulerTour.push_back(nd);
+        eulerDepth.push_back((int)stack.size() - 1);
+        if (next < nd->getChildCount()) {
+            stack.back().second++;
+            stack.push_back(std::make_pair(nd->getChild(next), 0));
+        } else {
+            stack.pop_back();
+        }
+    }
+    int m = (int)eulerTour.size();
+    sparseTable.push_back(std::vector<int>(m));
+    for (int i = 0; i < m; i++) {
+        sparseTable[0][i] = i;
+    }
+    for (int k = 1; (1 << k) <= m; k++) {
+        const std::vector<int>& prev = sparseTable[k-1];
+        std::vector<int> cur(m - (1 << k) + 1);
+        for (unsigned int i = 0; i < cur.size(); i++) {
+            int a = prev[i];
+            int b = prev[i + (1 << (k-1))];
+            cur[i] = (eulerDepth[b] < eulerDepth[a]) ? b : a;
+        }
+        sparseTable.push_back(cur);
+    }
+    lcaIndexed = true;
+}
+
+
+// position of the shallowest entry in [from, to] of the euler tour. O(1)
+int Tree::getShallowestInTour (int from, int to) {
+    int k = 31 - __builtin_clz(to - from + 1);
+    int a = sparseTable[k][from];
+    int b = sparseTable[k][to - (1 << k) + 1];
+    return (eulerDepth[b] < eulerDepth[a]) ? b : a;
+}
+
+
 /*
  * end private
  */
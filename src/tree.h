@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "node.h"
 
@@ -21,12 +22,23 @@ private:
     bool nodeAnnotations;
     bool internalNodeNames;
     
+    // lca index: euler tour of the nodes plus a sparse table of the
+    // shallowest node over each power-of-2 stretch of the tour
+    bool lcaIndexed;
+    std::vector<Node *> eulerTour;
+    std::vector<int> eulerDepth;
+    std::unordered_map<Node *, int> firstVisit;
+    std::vector<std::vector<int> > sparseTable;
+    std::unordered_map<std::string, Node *> externalNameMap;
+    
     void processReRoot (Node * node);
     void exchangeInfo (Node * node1, Node * node2);
     void postOrderProcessRoot (Node * node);
     Node * getMRCATraverse (Node * curn1, Node * curn2);
     void setHeightFromRootToNode (Node& inNode, double newHeight);
     double getGreatestDistance (Node * inNode);
+    void buildLCAIndex ();
+    int getShallowestInTour (int from, int to);
     
 public:
     Tree ();
@@ -59,8 +71,12 @@ public:
     bool reRoot (Node * inroot);
     void duplicateRootSupport ();
     void tritomyRoot (Node * toberoot);
+    // these (re)build the lca index on first use, so they are not safe to
+    // call on the same tree from several threads at once
     Node * getMRCA (std::vector<std::string> innodes);
     Node * getMRCA (std::vector<Node *> innodes);
+    Node * getMRCA (Node * nd1, Node * nd2);
+    void invalidateLCAIndex ();
     Node * getInternalMRCA (std::vector<std::string>& innodes);
     void processRoot ();
     void exchangeNodes (Node * node1, Node * node2);
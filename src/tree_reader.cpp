@@ -451,3 +451,39 @@ Tree * read_next_tree_from_stream_newick (std::istream& stri, std::string& retst
     tree = tr.readTree(tline);
     return tree;
 }
+
+
+TreeBlockReader::TreeBlockReader (std::istream& stri, const int& num_threads):stri_(stri),
+        filetype_(0), ttexists_(false), going_(true),
+        blocksize_(100 * std::max(1, num_threads)) {
+    filetype_ = test_tree_filetype_stream(stri_, retstring_);
+    if (filetype_ != 0 && filetype_ != 1) {
+        std::cerr << "Error: this really only works with nexus or newick. Exiting." << std::endl;
+        exit(0);
+    }
+    if (filetype_ == 0) {
+        ttexists_ = get_nexus_translation_table(stri_, &translation_table_, &retstring_);
+    }
+}
+
+
+// append up to a block of trees (the caller frees them). false once there are none left
+bool TreeBlockReader::next_block (std::vector<Tree *>& trees) {
+    while (going_ && (int)trees.size() < blocksize_) {
+        Tree * tree = NULL;
+        if (filetype_ == 0) {
+            tree = read_next_tree_from_stream_nexus(stri_, retstring_, ttexists_,
+                &translation_table_, &going_);
+        } else {
+            tree = read_next_tree_from_stream_newick(stri_, retstring_, &going_);
+            if (going_ == false && tree != NULL) {
+                delete tree;
+                tree = NULL;
+            }
+        }
+        if (tree != NULL) {
+            trees.push_back(tree);
+        }
+    }
+    return !trees.empty();
+}
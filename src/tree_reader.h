@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <iostream>
 
 #include "tree.h"
@@ -24,4 +25,24 @@ Tree * read_next_tree_from_stream_nexus (std::istream& stri, std::string& retstr
 Tree * read_next_tree_from_stream_newick (std::istream& stri, std::string& retstring,
         bool * going);
 
+/*
+ * hands out the trees of a nexus or newick stream a block at a time, so a
+ * program that only tallies them need not hold the whole file. the block
+ * size grows with the number of threads the caller shares a block among
+ */
+class TreeBlockReader {
+private:
+    std::istream& stri_;
+    std::string retstring_;
+    int filetype_;
+    bool ttexists_;
+    std::map<std::string, std::string> translation_table_;
+    bool going_;
+    int blocksize_;
+
+public:
+    TreeBlockReader (std::istream& stri, const int& num_threads);
+    bool next_block (std::vector<Tree *>& trees);
+};
+
 #endif /* _TREE_READER_H_ */
@@ -649,10 +649,11 @@ void deknuckle_tree (Tree * tree) {
             remove_knuckle(tnd);
         }
     }
+    tree->invalidateLCAIndex();
 }
 
 
-// remove a individual knuckle
+// remove a individual knuckle. the tree's lca index needs invalidating after
 void remove_knuckle (Node * node) {
     if (node->isKnuckle()) {
         double el = node->getBL(); // edge length